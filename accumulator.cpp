@@ -0,0 +1,136 @@
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "accumulator.hpp"
+#include "node_in_graph.hpp"
+
+namespace HWDG
+{
+	GraphAccumulator::GraphAccumulator(const Combiner& combiner, float balancer)
+	{
+		this->_combiner = combiner;
+		this->_balancer = balancer;
+		this->_compacted = 0;
+	}
+
+	float GraphAccumulator::Combine(const float& stored, const float& incoming) const
+	{
+		switch (this->_combiner)
+		{
+			case Combiner::Sum: return stored + incoming;
+			case Combiner::Max: return std::max(stored, incoming);
+			case Combiner::Balancer: break;
+		}
+		float weight_from_a = this->_balancer * stored;
+		float weight_from_b = ((float)1.0 - this->_balancer) * incoming;
+		return weight_from_a + weight_from_b;
+	}
+
+	void GraphAccumulator::Grow(void)
+	{
+		// Aggregate only when buffer has doubled since the last time, so cost of compaction is amortised
+		constexpr size_t minimal = 1 << 16;
+		if (this->_edges.size() + this->_nodes.size() > 2 * this->_compacted + minimal) this->compact();
+	}
+
+	void GraphAccumulator::add(const Graph& graph)
+	{
+		this->_nodes.reserve(this->_nodes.size() + graph.size_nodes());
+		this->_edges.reserve(this->_edges.size() + graph.size_edges());
+		for (const NodeInGraph& node : graph)
+		{
+			this->_nodes.push_back(node.id());
+			for (const Edge& edge : node) { this->_edges.push_back(edge); }
+		}
+		this->Grow();
+	}
+
+	void GraphAccumulator::add(const Edge& edge)
+	{
+		this->_nodes.push_back(edge.source().id());
+		this->_nodes.push_back(edge.target().id());
+		this->_edges.push_back(edge);
+		this->Grow();
+	}
+
+	void GraphAccumulator::add(const std::vector<Edge>& edges)
+	{
+		this->_nodes.reserve(this->_nodes.size() + 2 * edges.size());
+		this->_edges.reserve(this->_edges.size() + edges.size());
+		for (const Edge& edge : edges)
+		{
+			this->_nodes.push_back(edge.source().id());
+			this->_nodes.push_back(edge.target().id());
+			this->_edges.push_back(edge);
+		}
+		this->Grow();
+	}
+
+	void GraphAccumulator::add(const Node& node)
+	{
+		this->_nodes.push_back(node.id());
+		this->Grow();
+	}
+
+	void GraphAccumulator::merge(const GraphAccumulator& other)
+	{
+		if (this->_combiner != other._combiner || (this->_combiner == Combiner::Balancer && this->_balancer != other._balancer))
+		{
+			throw std::invalid_argument("GraphAccumulator: cannot merge accumulators with different combiners");
+		}
+		this->_nodes.insert(this->_nodes.end(), other._nodes.begin(), other._nodes.end());
+		this->_edges.insert(this->_edges.end(), other._edges.begin(), other._edges.end());
+		this->Grow();
+	}
+
+	void GraphAccumulator::compact(void)
+	{
+		std::sort(this->_nodes.begin(), this->_nodes.end());
+		this->_nodes.erase(std::unique(this->_nodes.begin(), this->_nodes.end()), this->_nodes.end());
+		// Stable sort keeps duplicates in order of ingestion, which matters for Combiner::Balancer. Edges are grouped by source node.
+		std::stable_sort(this->_edges.begin(), this->_edges.end(), [](const Edge& l, const Edge& r) {
+			if (l.source().id() != r.source().id()) return l.source().id() < r.source().id();
+			return l.target().id() < r.target().id();
+		});
+		size_t last = 0;
+		for (size_t i = 1; i < this->_edges.size(); ++i)
+		{
+			const Edge& edge = this->_edges[i];
+			if (edge == this->_edges[last])
+			{
+				this->_edges[last] = Edge(edge.source(), edge.target(), this->Combine(this->_edges[last].weight(), edge.weight()));
+			}
+			else
+			{
+				this->_edges[++last] = edge;
+			}
+		}
+		if (this->_edges.size()) this->_edges.erase(this->_edges.begin() + last + 1, this->_edges.end());
+		this->_compacted = this->_edges.size() + this->_nodes.size();
+	}
+
+	size_t GraphAccumulator::size_staged(void) const
+	{
+		return this->_edges.size();
+	}
+
+	Graph GraphAccumulator::Build(void)
+	{
+		this->compact();
+		Graph output;
+		output.reserve_nodes(this->_nodes.size());
+		output.reserve_edges(this->_edges.size());
+		for (const uint32_t& id : this->_nodes) { output.add(Node(id)); }
+		for (size_t first = 0; first < this->_edges.size();)
+		{
+			const Node& source = this->_edges[first].source();
+			size_t last = first;
+			while (last < this->_edges.size() && this->_edges[last].source() == source) { last++; }
+			output.reserve_edges_in_node(source, last - first);
+			for (size_t i = first; i < last; ++i) { output.add(this->_edges[i]); }
+			first = last;
+		}
+		return output;
+	}
+}
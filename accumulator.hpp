@@ -0,0 +1,137 @@
+#ifndef HWDG_ACCUMULATOR_HPP
+#define HWDG_ACCUMULATOR_HPP
+
+/**
+* @file accumulator.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Streaming union of many graphs.
+*
+* This file contains GraphAccumulator class, which folds large number of graphs (or batches of edges) into single Graph.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace HWDG
+{
+	/**
+	* Streaming union of many graphs.
+	*
+	* Repeated Operations::MergeUnion() rehashes growing Graph over and over. GraphAccumulator appends ingested edges to plain staging buffer instead, 
+	* aggregates duplicates (by sorting) only when buffer grows twice since the last aggregation, and builds the final Graph once, with all memory reserved up front.
+	*
+	* Result of GraphAccumulator::Build() is the same as if every ingested graph was merged, in order of ingestion, into initially empty Graph:
+	* - Combiner::Sum - Operations::MergeUnion(Graph&, const Graph&)
+	* - Combiner::Balancer - Operations::MergeUnion(Graph&, const Graph&, float)
+	* - Combiner::Max - union keeping maximal weight of the edge.
+	*
+	* Accumulator isn't thread-safe, but accumulators filled by separate threads can be combined with GraphAccumulator::merge().
+	*/
+	class GraphAccumulator
+	{
+		public:
+			/**
+			* How weights of duplicated edges are combined.
+			*/
+			enum class Combiner
+			{
+				//! \f$ w_{stored} + w_{incoming} \f$
+				Sum,
+				//! \f$ L*w_{stored} + (1-L)*w_{incoming} \f$, where \f$L\f$ is balancer
+				Balancer,
+				//! \f$ max(w_{stored}, w_{incoming}) \f$
+				Max
+			};
+		private:
+			Combiner _combiner;
+			float _balancer;
+			std::vector<uint32_t> _nodes;
+			std::vector<Edge> _edges;
+			size_t _compacted;
+		private:
+			float Combine(const float& stored, const float& incoming) const;
+			void Grow(void);
+		public:
+			/**
+			* Create empty accumulator.
+			* \param combiner How weights of duplicated edges are combined.
+			* \param balancer Balancing factor used by Combiner::Balancer. MUST belong to [0,1]
+			*/
+			GraphAccumulator(const Combiner& combiner = Combiner::Sum, float balancer = 0.5);
+
+			/**
+			* Ingest all nodes and edges of the Graph.
+			* \param graph Graph to be ingested.
+			* \par Time complexity:
+			* \f$O(edges)\f$ amortised.
+			*/
+			void add(const Graph& graph);
+
+			/**
+			* Ingest single Edge (and both of its' nodes).
+			* \param edge Edge to be ingested.
+			* \par Time complexity:
+			* \f$O(1)\f$ amortised.
+			*/
+			void add(const Edge& edge);
+
+			/**
+			* Ingest batch of edges (and their nodes).
+			* Edges within the batch are treated as if they were ingested one after another, so duplicates inside the batch are combined too.
+			* \param edges Edges to be ingested.
+			* \par Time complexity:
+			* \f$O(n)\f$ amortised.
+			*/
+			void add(const std::vector<Edge>& edges);
+
+			/**
+			* Ingest Node without any edges.
+			* \param node Node to be ingested.
+			* \par Time complexity:
+			* \f$O(1)\f$ amortised.
+			*/
+			void add(const Node& node);
+
+			/**
+			* Append everything ingested by other accumulator, as if it was ingested by this one after everything else.
+			* Typical usage: every thread fills its' own accumulator, then they're merged into one.
+			*
+			* For Combiner::Balancer, order of merging matters the same way as order of ingestion does.
+			* \param other Accumulator to be merged. It must use the same Combiner and balancer.
+			* \throws std::invalid_argument if other accumulator has different Combiner or balancer.
+			* \par Time complexity:
+			* \f$O(n)\f$ amortised, where n is number of edges staged in other accumulator.
+			*/
+			void merge(const GraphAccumulator& other);
+
+			/**
+			* Aggregate duplicates staged so far.
+			* It's called automatically, there's no need to call it manually unless you want to reduce memory usage right now.
+			* \par Time complexity:
+			* \f$O(n \log_{2} n)\f$, where n is number of staged edges.
+			*/
+			void compact(void);
+
+			/**
+			* Get number of edges within staging buffer (duplicates included).
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_staged(void) const;
+
+			/**
+			* Build Graph out of everything ingested so far.
+			* Accumulator stays valid, you can ingest more data and build again.
+			* \return Union of everything ingested.
+			* \par Time complexity:
+			* \f$O(n \log_{2} n)\f$, where n is number of staged edges.
+			*/
+			Graph Build(void);
+	};
+}
+
+#endif
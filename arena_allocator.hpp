@@ -0,0 +1,241 @@
+#ifndef HWDG_ARENA_ALLOCATOR_HPP
+#define HWDG_ARENA_ALLOCATOR_HPP
+
+/**
+* @file arena_allocator.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Arena allocator for elements of hash maps.
+*
+* This file contains Arena, monotonic storage of fixed-size blocks, Arenas, set of arenas keyed by size of block, and ArenaAllocator, STL-compatible allocator giving every map its' own Arenas.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace HWDG
+{
+	namespace Map
+	{
+		/**
+		* Monotonic storage of blocks of one size, carved out of chunks growing geometrically.
+		* Blocks are handed out in order of allocation, so elements inserted one after another lie next to each other in memory. Released blocks are reused before new ones,
+		* and chunks are returned to the heap all at once, when Arena is destroyed.
+		*
+		* Arena isn't synchronised, it's meant to be used by single container at a time.
+		*/
+		class Arena
+		{
+			public:
+				/**
+				* Alignment of every block.
+				*/
+				static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+			private:
+				struct Chunk
+				{
+					Chunk* next;
+				};
+
+				struct Block
+				{
+					Block* next;
+				};
+
+				static constexpr size_t HEADER = (sizeof(Chunk) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+				static constexpr size_t FIRST_BLOCKS = 4;
+				static constexpr size_t MAX_BLOCKS = 65536;
+
+				Chunk* _chunks = nullptr;
+				Block* _free = nullptr;
+				char* _cursor = nullptr;
+				char* _end = nullptr;
+				size_t _block;
+				size_t _next_blocks = FIRST_BLOCKS;
+
+			public:
+				/**
+				* Round size of memory up to multiple of ALIGNMENT.
+				* \param bytes Size of memory.
+				* \return Size of block serving that memory.
+				*/
+				static size_t Round(const size_t& bytes) { return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+				/**
+				* Create empty Arena, memory is taken from heap with the first allocate()
+				* \param bytes Size of every block, rounded up to multiple of ALIGNMENT.
+				*/
+				explicit Arena(const size_t& bytes) : _block(Arena::Round(bytes)) {}
+				Arena(const Arena&) = delete;
+				Arena& operator=(const Arena&) = delete;
+
+				~Arena()
+				{
+					while (this->_chunks)
+					{
+						Chunk* next = this->_chunks->next;
+						::operator delete(this->_chunks);
+						this->_chunks = next;
+					}
+				}
+
+				/**
+				* Get size of every block.
+				* \par Time complexity:
+				* \f$O(1)\f$
+				*/
+				size_t block(void) const { return this->_block; }
+
+				/**
+				* Get single block, released one if there's any, otherwise next one in the current chunk.
+				* \throws std::bad_alloc if there's no memory left.
+				* \par Time complexity:
+				* \f$O(1)\f$ amortised.
+				*/
+				void* allocate(void)
+				{
+					if (this->_free)
+					{
+						Block* block = this->_free;
+						this->_free = block->next;
+						return block;
+					}
+					if (this->_cursor == this->_end)
+					{
+						char* memory = static_cast<char*>(::operator new(HEADER + this->_next_blocks * this->_block));
+						Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+						chunk->next = this->_chunks;
+						this->_chunks = chunk;
+						this->_cursor = memory + HEADER;
+						this->_end = this->_cursor + this->_next_blocks * this->_block;
+						this->_next_blocks = std::min(2 * this->_next_blocks, MAX_BLOCKS);
+					}
+					void* output = this->_cursor;
+					this->_cursor = this->_cursor + this->_block;
+					return output;
+				}
+
+				/**
+				* Give block back, to be reused by following allocate()
+				* \param pointer Block returned by allocate()
+				* \par Time complexity:
+				* \f$O(1)\f$
+				*/
+				void deallocate(void* pointer) noexcept
+				{
+					Block* block = static_cast<Block*>(pointer);
+					block->next = this->_free;
+					this->_free = block;
+				}
+		};
+
+		/**
+		* Arenas of one container, one for every size of block. Besides elements, containers may allocate single objects of other types (rebinding allocator), 
+		* so blocks of every size are kept apart and every allocation is served by Arena of its' own size. Containers use one or two sizes, so Arena is found by linear search.
+		*
+		* Arenas aren't synchronised, just like Arena.
+		*/
+		class Arenas
+		{
+			private:
+				std::vector<std::unique_ptr<Arena>> _arenas;
+			public:
+				/**
+				* Get Arena of blocks of given size, create it if there's none yet.
+				* \param bytes Size of single object.
+				* \return Arena serving objects of that size. Reference stays valid as long as Arenas exists.
+				* \par Time complexity:
+				* \f$O(sizes)\f$
+				*/
+				Arena& of(const size_t& bytes)
+				{
+					const size_t block = Arena::Round(bytes);
+					for (const std::unique_ptr<Arena>& arena : this->_arenas)
+					{
+						if (arena->block() == block) return *arena;
+					}
+					this->_arenas.push_back(std::make_unique<Arena>(block));
+					return *this->_arenas.back();
+				}
+		};
+
+		/**
+		* STL-compatible allocator, serving single objects (elements of container) from Arenas owned by that container, and arrays (buckets of hash maps) from operator new.
+		*
+		* Hash maps allocate every element separately, so maps with millions of elements make millions of calls to general-purpose heap, and scatter elements over it.
+		* With ArenaAllocator elements of map are packed in chunks in order of insertion, allocation is a pointer bump, and destroying map releases chunks instead of every element.
+		*
+		* Allocator is stateful. Copy of container gets new Arenas (select_on_container_copy_construction()), while moved and swapped containers take theirs with them.
+		* Arenas are shared by all copies of allocator, rebound ones included, so they live as long as any container or allocator referring to them. 
+		* Allocator of every type takes Arena of size of that type, so memory is always released to Arena it came from.
+		*/
+		template<typename TYPE>
+		class ArenaAllocator
+		{
+			template<typename OTHER>
+			friend class ArenaAllocator;
+			private:
+				static constexpr bool ARENA = alignof(TYPE) <= Arena::ALIGNMENT;
+				std::shared_ptr<Arenas> _arenas;
+			public:
+				using value_type = TYPE;
+				using propagate_on_container_copy_assignment = std::false_type;
+				using propagate_on_container_move_assignment = std::true_type;
+				using propagate_on_container_swap = std::true_type;
+				using is_always_equal = std::false_type;
+
+				/**
+				* Create allocator with new, empty Arenas.
+				*/
+				ArenaAllocator() : _arenas(std::make_shared<Arenas>()) {}
+
+				/**
+				* Allocators are required to stay unchanged when moved from, so moving is copying.
+				*/
+				ArenaAllocator(const ArenaAllocator& other) noexcept = default;
+
+				template<typename OTHER>
+				ArenaAllocator(const ArenaAllocator<OTHER>& other) noexcept : _arenas(other._arenas) {}
+
+				/**
+				* Copies of containers don't share memory with originals.
+				* \return Allocator with new Arenas.
+				*/
+				ArenaAllocator select_on_container_copy_construction(void) const { return ArenaAllocator(); }
+
+				/**
+				* Allocate memory for count objects.
+				* \param count Number of objects.
+				* \throws std::bad_alloc if there's no memory left.
+				*/
+				TYPE* allocate(const size_t& count)
+				{
+					if (ARENA && count == 1) return static_cast<TYPE*>(this->_arenas->of(sizeof(TYPE)).allocate());
+					return std::allocator<TYPE>().allocate(count);
+				}
+
+				/**
+				* Release memory of count objects.
+				* \param pointer Memory returned by allocate()
+				* \param count Number of objects, the same as passed to allocate()
+				*/
+				void deallocate(TYPE* pointer, const size_t& count) noexcept
+				{
+					if (ARENA && count == 1) this->_arenas->of(sizeof(TYPE)).deallocate(pointer);
+					else std::allocator<TYPE>().deallocate(pointer, count);
+				}
+
+				template<typename OTHER>
+				bool operator == (const ArenaAllocator<OTHER>& other) const noexcept { return this->_arenas == other._arenas; }
+
+				template<typename OTHER>
+				bool operator != (const ArenaAllocator<OTHER>& other) const noexcept { return this->_arenas != other._arenas; }
+		};
+	}
+}
+
+#endif
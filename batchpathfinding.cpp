@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "batchpathfinding.hpp"
+#include "dijkstra.hpp"
+#include "bellmanford.hpp"
+#include "bfspathfinding.hpp"
+#include "path.hpp"
+#include "threadpool.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	BatchPathfinding::Query::Query(const Algorithm& algorithm, const Node& source, const Node& target) : algorithm(algorithm), source(source), target(target) {}
+
+	Path BatchPathfinding::Execute(const Graph& graph, const Query& query, Workspace& workspace)
+	{
+		// Checked once for all algorithms, so target outside of Graph is answered the same way by every one of them
+		if (!graph.has(query.source)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", query.source.str().c_str()));
+		if (!graph.has(query.target)) return Path({ query.target }, std::numeric_limits<double>::max(), false);
+		switch (query.algorithm)
+		{
+			case Algorithm::Dijkstra: return Dijkstra::ComputePath(graph, query.source, query.target, workspace);
+			case Algorithm::BFS: return BFSPathfinding::ComputePath(graph, query.source, query.target, workspace);
+			case Algorithm::BellmanFord: break;
+		}
+		return BellmanFord::ComputePath(graph, query.source, query.target, workspace);
+	}
+
+	std::vector<Path> BatchPathfinding::Compute(const Graph& graph, const std::vector<Query>& queries, ThreadPool& pool)
+	{
+		std::vector<Path> output(queries.size(), Path({}, std::numeric_limits<double>::max(), false));
+		// Workspaces live only during this call. Task takes free one (or creates new one) and gives it back when done, so there are no more of them than tasks running at once.
+		std::vector<std::unique_ptr<Workspace>> workspaces;
+		std::mutex lock;
+		pool.ParallelFor(0, queries.size(), 1, [&](size_t first, size_t last) {
+			std::unique_ptr<Workspace> workspace;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				if (workspaces.size()) { workspace = std::move(workspaces.back()); workspaces.pop_back(); }
+			}
+			if (!workspace) workspace = std::make_unique<Workspace>();
+			for (size_t i = first; i < last; ++i)
+			{
+				output[i] = BatchPathfinding::Execute(graph, queries[i], *workspace);
+			}
+			std::lock_guard<std::mutex> guard(lock);
+			workspaces.push_back(std::move(workspace));
+		});
+		return output;
+	}
+}
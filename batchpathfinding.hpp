@@ -0,0 +1,83 @@
+#ifndef HWDG_BATCHPATHFINDING_HPP
+#define HWDG_BATCHPATHFINDING_HPP
+
+/**
+* @file batchpathfinding.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Parallel execution of many independent pathfinding queries.
+*
+* This file contains class BatchPathfinding, which runs list of source-target queries against single Graph on multiple threads.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "graph.hpp"
+#include "path.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class executing batches of pathfinding queries in parallel.
+	* Because it's static class, you can't create objects of it. You are supposed only to call BatchPathfinding::Compute() static function.
+	*
+	* Thread-safety: pathfinding algorithms access Graph only through its' const member functions (Graph::has(), Graph::fetch(), iteration over nodes and edges).
+	* Those never modify internal unordered maps, and C++ standard guarantees that const access to STL containers is safe from many threads at once.
+	* Because of that, single Graph can be searched by any number of threads at the same time, as long as nobody modifies it during BatchPathfinding::Compute().
+	*/
+	class BatchPathfinding
+	{
+		public:
+			/**
+			* Pathfinding algorithm used to answer a Query.
+			*/
+			enum class Algorithm
+			{
+				//! Dijkstra::ComputePath(), stops as soon as target is settled.
+				Dijkstra,
+				//! BellmanFord::ComputePath(), creates cells only for nodes reachable from source, but can't stop when target is reached.
+				BellmanFord,
+				//! BFSPathfinding::ComputePath(), ignores weights and stops as soon as target is reached.
+				BFS
+			};
+
+			/**
+			* Single pathfinding query: algorithm, source Node and target Node.
+			*/
+			struct Query
+			{
+				//! Algorithm used to answer this query
+				Algorithm algorithm;
+				//! Source Node
+				Node source;
+				//! Target Node
+				Node target;
+
+				Query() = delete;
+				Query(const Algorithm& algorithm, const Node& source, const Node& target);
+			};
+		private:
+			static Path Execute(const Graph& graph, const Query& query, Workspace& workspace);
+		public:
+			/**
+			* Execute all queries against given Graph.
+			* Queries are distributed between threads of the pool dynamically. Running task reuses one Workspace for all the queries it answers, and Workspaces are released when function returns.
+			* Query with target Node outside of Graph is answered with Path that doesn't exist, whatever algorithm is used.
+			*
+			* \param graph Graph that you want to search. It must not be modified until function returns.
+			* \param queries List of queries.
+			* \param pool ThreadPool executing the queries.
+			* \return List of paths, i-th Path is the answer for i-th Query.
+			* \throws std::invalid_argument if any of the queries can't be answered (source Node outside of Graph, or conditions of underlying algorithm). If more than one query fails, exception of one of them is thrown.
+			*
+			* \par Time complexity:
+			* \f$O(queries * T_{algorithm} / threads)\f$
+			*/
+			static std::vector<Path> Compute(const Graph& graph, const std::vector<Query>& queries, ThreadPool& pool = ThreadPool::Default());
+			BatchPathfinding() = delete;
+	};
+}
+
+#endif
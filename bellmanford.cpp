@@ -8,6 +8,7 @@
 #include "custom_map.hpp"
 #include "tools.hpp"
 #include "path.hpp"
+#include "dagpathfinding.hpp"
 
 namespace HWDG
 {
@@ -73,7 +74,53 @@ namespace HWDG
 
 	Pathtable<PathtableCell> BellmanFord::Compute(const Graph& graph, const Node& src)
 	{
+		// Acyclic graphs are solved in linear time by relaxing edges in topological order
+		std::vector<Node> order;
+		if (!graph.has_loops() && DAGPathfinding::Order(graph, order))
+		{
+			if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+			return DAGPathfinding::Relax(graph, src, order, false);
+		}
 		BellmanFord vessel(graph, src);
 		return vessel.Results();
 	}
+
+	Path BellmanFord::ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace)
+	{
+		if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+		workspace.Clear();
+		auto& cells = workspace._cells;
+		auto& queue = workspace._queue; // used as FIFO queue, 'first' holds pathweight at the moment of queueing
+		auto& lengths = workspace._lengths; // number of edges of path found to every Node
+		cells.insert({ src.id(), PathtableCell(src, src) });
+		lengths.insert({ src.id(), 0 });
+		queue.push_back({ 0, src.id() });
+		for (size_t next = 0; next < queue.size(); ++next)
+		{
+			const uint32_t id = queue[next].second;
+			const double pathweight = cells.at(id).pathweight;
+			// Node was improved again after being queued, it will be relaxed by the later entry
+			if (queue[next].first != pathweight) continue;
+			const uint32_t length = lengths.at(id) + 1;
+			for (const Edge& edge : graph.fetch(Node(id)))
+			{
+				const double pathweight_from_current = pathweight + edge.weight();
+				auto iter = cells.find(edge.target().id());
+				if (iter == cells.end())
+				{
+					cells.insert({ edge.target().id(), PathtableCell(edge.target(), pathweight_from_current, id) });
+				}
+				else if (iter->second.pathweight > pathweight_from_current)
+				{
+					if (iter->second.prev_id == PathtableCell::STARTING || length >= graph.size_nodes()) throw std::invalid_argument("Negative cycle detected");
+					iter->second.pathweight = pathweight_from_current;
+					iter->second.prev_id = id;
+				}
+				else continue;
+				lengths[edge.target().id()] = length;
+				queue.push_back({ pathweight_from_current, edge.target().id() });
+			}
+		}
+		return workspace.GetPath(tgt);
+	}
 }
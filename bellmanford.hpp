@@ -47,6 +47,8 @@ namespace HWDG
 			* So it's impossible to establish shortest path in Graph with negative cycles, because shortest path depends on number of iterations over negative cycles.
 			*
 			* Bellman-Ford algorithm can be used to detect negative cycles. If it throws std::invalid_argument, then there's negative cycle.
+			*
+			* If Graph turns out to be acyclic, DAGPathfinding::ShortestPaths() is used instead, with the same results in linear time.
 			* 
 			* \param graph Graph that you want to find Pathtable for.
 			* \param src Source Node, for which the Pathtable will be created.
@@ -54,9 +56,26 @@ namespace HWDG
 			* \throws std::invalid_argument if Graph has negative cycles.
 			* 
 			* \par Time complexity:
-			* \f$O(nodes^2)\f$
+			* \f$O(nodes^2)\f$, or \f$O(nodes + edges)\f$ for acyclic graphs.
 			*/
 			static Pathtable<PathtableCell> Compute(const Graph& graph, const Node& src);
+
+			/**
+			* Bellman-Ford algorithm for pathfinding between single pair of nodes, creating cells only for nodes reachable from source.
+			* Nodes are relaxed in FIFO order, only after their' pathweight changed (queue-based Bellman-Ford). Negative cycle is detected when path found to some Node has at least as many edges as there are nodes in Graph.
+			* Unlike Dijkstra::ComputePath(), search can't stop when target is reached, because negative edges can still make its' path shorter.
+			*
+			* \param graph Graph that you want to search.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \param workspace Workspace to be used (and reused by next queries). After the call, it holds cells of all nodes reachable from source.
+			* \return Shortest path from source to target Node.
+			* \throws std::invalid_argument if source Node doesn't belong to Graph, or negative cycle is reachable from source.
+			*
+			* \par Time complexity:
+			* \f$O(nodes * edges)\f$ in the worst case, \f$O(edges)\f$ typically.
+			*/
+			static Path ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace);
 			BellmanFord() = delete;
 	}; 
 }
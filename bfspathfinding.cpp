@@ -4,6 +4,7 @@
 #include "graph.hpp"
 #include "path.hpp"
 #include "operations.hpp"
+#include "tools.hpp"
 
 namespace HWDG
 {
@@ -20,4 +21,28 @@ namespace HWDG
 
 		return table;
 	}
-}
\ No newline at end of file
+
+	Path BFSPathfinding::ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace)
+	{
+		if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+		workspace.Clear();
+		auto& cells = workspace._cells;
+		auto& queue = workspace._queue; // used as FIFO queue, 'first' holds depth
+		cells.insert({ src.id(), PathtableCell(src, src) });
+		queue.push_back({ 0, src.id() });
+		for (size_t next = 0; next < queue.size(); ++next)
+		{
+			const double pathweight = queue[next].first;
+			const uint32_t id = queue[next].second;
+			if (id == tgt.id()) break;
+			for (const Edge& edge : graph.fetch(Node(id)))
+			{
+				if (cells.find(edge.target().id()) != cells.end()) continue;
+				cells.insert({ edge.target().id(), PathtableCell(edge.target(), pathweight + BFSPathfinding::EdgeWeight, id) });
+				queue.push_back({ pathweight + BFSPathfinding::EdgeWeight, edge.target().id() });
+				if (edge.target() == tgt) return workspace.GetPath(tgt);
+			}
+		}
+		return workspace.GetPath(tgt);
+	}
+}
@@ -40,6 +40,22 @@ namespace HWDG
 			* \f$O(nodes)\f$
 			*/
 			static Pathtable<PathtableCell> Compute(const Graph& graph, const Node& src);
+
+			/**
+			* BFS-based algorithm for pathfinding between single pair of nodes. Ignores weights.
+			* Traversal stops as soon as target Node is reached. Check BFSPathfinding::Compute() for details about weights.
+			*
+			* \param graph Graph that you want to search.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \param workspace Workspace to be used (and reused by next queries). After the call, it holds cells of all nodes reached by the search.
+			* \return Path from source to target Node with minimal number of edges.
+			* \throws std::invalid_argument if source Node doesn't belong to Graph.
+			*
+			* \par Time complexity:
+			* \f$O(edges)\f$ in the worst case.
+			*/
+			static Path ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace);
 			BFSPathfinding() = delete;
 	};
 }
@@ -0,0 +1,234 @@
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "centrality.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	std::vector<double> Centrality::PowerIteration(const CompactGraph& graph, const std::vector<double>& teleport, const double& damping, const double& tolerance, const size_t& max_iterations, ThreadPool& pool)
+	{
+		if (damping < 0 || damping >= 1) throw std::invalid_argument(Tools::string_format("PageRank: damping %f doesn't belong to [0,1)", damping));
+		const size_t n = graph.size_nodes();
+		constexpr size_t grain = 1024;
+
+		// Outgoing weight of every node, used to normalise weights into transition probabilities
+		std::vector<double> out_weight(n, 0);
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = graph.offsets()[i]; e < graph.offsets()[i + 1]; ++e)
+			{
+				if (graph.weights()[e] < 0) throw std::invalid_argument("PageRank: graph has negative weights");
+				out_weight[i] = out_weight[i] + graph.weights()[e];
+			}
+		}
+		const CompactGraph transposed = graph.Transpose();
+		std::vector<double> probability(transposed.size_edges());
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = transposed.offsets()[i]; e < transposed.offsets()[i + 1]; ++e)
+			{
+				// Rank of node with weights summing up to 0 is spread by dangling term only
+				const double total = out_weight[transposed.targets()[e]];
+				probability[e] = total > 0 ? transposed.weights()[e] / total : 0;
+			}
+		}
+
+		std::vector<double> rank = teleport;
+		std::vector<double> next(n, 0);
+		for (size_t iteration = 0; iteration < max_iterations; ++iteration)
+		{
+			// Nodes without outgoing edges (or with weights summing up to 0) give their rank away by teleporting
+			const double dangling = pool.ParallelReduce<double>(0, n, grain, 0.0, [&](size_t first, size_t last) {
+				double sum = 0;
+				for (size_t i = first; i < last; ++i) { if (out_weight[i] <= 0) sum = sum + rank[i]; }
+				return sum;
+			}, [](const double& l, const double& r) { return l + r; });
+
+			const double change = pool.ParallelReduce<double>(0, n, grain, 0.0, [&](size_t first, size_t last) {
+				double sum = 0;
+				for (size_t i = first; i < last; ++i)
+				{
+					double incoming = 0;
+					for (size_t e = transposed.offsets()[i]; e < transposed.offsets()[i + 1]; ++e)
+					{
+						incoming = incoming + rank[transposed.targets()[e]] * probability[e];
+					}
+					next[i] = (1 - damping) * teleport[i] + damping * (incoming + dangling * teleport[i]);
+					sum = sum + std::fabs(next[i] - rank[i]);
+				}
+				return sum;
+			}, [](const double& l, const double& r) { return l + r; });
+			rank.swap(next);
+			if (change < tolerance) break;
+		}
+		return rank;
+	}
+
+	std::vector<double> Centrality::PageRank(const CompactGraph& graph, const double& damping, const double& tolerance, const size_t& max_iterations, ThreadPool& pool)
+	{
+		const size_t n = graph.size_nodes();
+		if (n == 0) return std::vector<double>();
+		return Centrality::PowerIteration(graph, std::vector<double>(n, 1.0 / n), damping, tolerance, max_iterations, pool);
+	}
+
+	std::vector<double> Centrality::PersonalizedPageRank(const CompactGraph& graph, const std::vector<Node>& sources, const double& damping, const double& tolerance, const size_t& max_iterations, ThreadPool& pool)
+	{
+		if (sources.empty()) throw std::invalid_argument("PersonalizedPageRank: at least one source node is required");
+		std::vector<double> teleport(graph.size_nodes(), 0);
+		for (const Node& source : sources)
+		{
+			teleport[graph.index(source)] += 1.0 / sources.size();
+		}
+		return Centrality::PowerIteration(graph, teleport, damping, tolerance, max_iterations, pool);
+	}
+
+	std::vector<double> Centrality::Brandes(const CompactGraph& graph, const std::vector<uint32_t>& sources, bool weighted, ThreadPool& pool)
+	{
+		const size_t n = graph.size_nodes();
+		if (weighted)
+		{
+			// Zero-weight edges would let nodes of equal distance settle before their predecessors, breaking path counts
+			for (const float& weight : graph.weights()) { if (weight <= 0) throw std::invalid_argument("Betweenness: graph has non-positive weights"); }
+		}
+		const auto& offsets = graph.offsets();
+		const auto& targets = graph.targets();
+		const auto& weights = graph.weights();
+		// One chunk of sources per thread: every chunk owns accumulator of size n, so there can't be more of them
+		const size_t chunks = std::max<size_t>(1, std::min(pool.size(), sources.size()));
+		std::vector<std::vector<double>> scores(chunks);
+
+		pool.ParallelFor(0, chunks, 1, [&](size_t chunk_first, size_t chunk_last) {
+			for (size_t chunk = chunk_first; chunk < chunk_last; ++chunk)
+			{
+				const size_t first = sources.size() * chunk / chunks;
+				const size_t last = sources.size() * (chunk + 1) / chunks;
+				std::vector<double>& score = scores[chunk];
+				score.assign(n, 0);
+				std::vector<double> distance(n, std::numeric_limits<double>::max());
+				std::vector<double> paths(n, 0);
+				std::vector<double> dependency(n, 0);
+				std::vector<uint32_t> settled;
+				std::vector<std::pair<double, uint32_t>> queue;
+				const auto compare = std::greater<std::pair<double, uint32_t>>();
+				settled.reserve(n);
+				for (size_t s = first; s < last; ++s)
+				{
+					const uint32_t source = sources[s];
+					distance[source] = 0;
+					paths[source] = 1;
+					// Shortest paths, counting number of them. Nodes are stored in order of settling.
+					if (weighted)
+					{
+						queue.push_back({ 0, source });
+						while (queue.size())
+						{
+							std::pop_heap(queue.begin(), queue.end(), compare);
+							const double pathweight = queue.back().first;
+							const uint32_t current = queue.back().second;
+							queue.pop_back();
+							// Lazy deletion: skip outdated entries, and entries of nodes settled already
+							if (pathweight > distance[current] || dependency[current] < 0) continue;
+							dependency[current] = -1;
+							settled.push_back(current);
+							for (size_t e = offsets[current]; e < offsets[current + 1]; ++e)
+							{
+								const uint32_t target = targets[e];
+								const double candidate = pathweight + weights[e];
+								if (candidate < distance[target])
+								{
+									distance[target] = candidate;
+									paths[target] = paths[current];
+									queue.push_back({ candidate, target });
+									std::push_heap(queue.begin(), queue.end(), compare);
+								}
+								else if (candidate == distance[target] && dependency[target] >= 0) paths[target] = paths[target] + paths[current];
+							}
+						}
+					}
+					else
+					{
+						settled.push_back(source);
+						for (size_t i = 0; i < settled.size(); ++i)
+						{
+							const uint32_t current = settled[i];
+							for (size_t e = offsets[current]; e < offsets[current + 1]; ++e)
+							{
+								const uint32_t target = targets[e];
+								const double candidate = distance[current] + 1;
+								if (distance[target] == std::numeric_limits<double>::max())
+								{
+									distance[target] = candidate;
+									settled.push_back(target);
+								}
+								if (distance[target] == candidate) paths[target] = paths[target] + paths[current];
+							}
+						}
+					}
+					// Accumulation of dependencies, from the farthest nodes. Predecessors are recognised by distance, so they don't have to be stored.
+					for (const uint32_t& node : settled) { dependency[node] = 0; }
+					for (auto iter = settled.rbegin(); iter != settled.rend(); ++iter)
+					{
+						const uint32_t current = *iter;
+						for (size_t e = offsets[current]; e < offsets[current + 1]; ++e)
+						{
+							const uint32_t target = targets[e];
+							const double length = weighted ? (double)weights[e] : 1.0;
+							if (distance[target] != distance[current] + length || paths[target] == 0) continue;
+							dependency[current] = dependency[current] + paths[current] / paths[target] * (1 + dependency[target]);
+						}
+						if (current != source) score[current] = score[current] + dependency[current];
+					}
+					for (const uint32_t& node : settled)
+					{
+						distance[node] = std::numeric_limits<double>::max();
+						paths[node] = 0;
+						dependency[node] = 0;
+					}
+					settled.clear();
+				}
+			}
+		});
+		// Accumulators are added in order of chunks, each one released right after
+		std::vector<double> output = std::move(scores[0]);
+		for (size_t chunk = 1; chunk < chunks; ++chunk)
+		{
+			for (size_t i = 0; i < n; ++i) { output[i] = output[i] + scores[chunk][i]; }
+			std::vector<double>().swap(scores[chunk]);
+		}
+		return output;
+	}
+
+	std::vector<double> Centrality::Betweenness(const CompactGraph& graph, bool weighted, ThreadPool& pool)
+	{
+		std::vector<uint32_t> sources(graph.size_nodes());
+		for (uint32_t i = 0; i < sources.size(); ++i) { sources[i] = i; }
+		std::vector<double> output = Centrality::Brandes(graph, sources, weighted, pool);
+		output.resize(graph.size_nodes(), 0);
+		return output;
+	}
+
+	std::vector<double> Centrality::ApproximateBetweenness(const CompactGraph& graph, const size_t& samples, const uint64_t& seed, bool weighted, ThreadPool& pool)
+	{
+		if (samples == 0) throw std::invalid_argument("ApproximateBetweenness: at least one sample is required");
+		const size_t n = graph.size_nodes();
+		if (samples >= n) return Centrality::Betweenness(graph, weighted, pool);
+		// Partial Fisher-Yates shuffle picks distinct sources
+		std::vector<uint32_t> sources(n);
+		for (uint32_t i = 0; i < n; ++i) { sources[i] = i; }
+		for (size_t i = 0; i < samples; ++i)
+		{
+			std::swap(sources[i], sources[i + Tools::Mix64(seed ^ Tools::Mix64(i)) % (n - i)]);
+		}
+		sources.resize(samples);
+		std::vector<double> output = Centrality::Brandes(graph, sources, weighted, pool);
+		output.resize(n, 0);
+		const double scale = (double)n / samples;
+		for (double& score : output) { score = score * scale; }
+		return output;
+	}
+}
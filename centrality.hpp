@@ -0,0 +1,121 @@
+#ifndef HWDG_CENTRALITY_HPP
+#define HWDG_CENTRALITY_HPP
+
+/**
+* @file centrality.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Centrality (importance) measures of nodes.
+*
+* This file contains Centrality class, which ranks nodes of CompactGraph.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class containing centrality measures of nodes.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* Scores are returned as dense array indexed by CompactGraph::index(), identifier of Node with index i is CompactGraph::ids()[i].
+	*/
+	class Centrality
+	{
+		private:
+			static std::vector<double> PowerIteration(const CompactGraph& graph, const std::vector<double>& teleport, const double& damping, const double& tolerance, const size_t& max_iterations, ThreadPool& pool);
+			static std::vector<double> Brandes(const CompactGraph& graph, const std::vector<uint32_t>& sources, bool weighted, ThreadPool& pool);
+		public:
+			/**
+			* Default probability of following an Edge, instead of teleporting.
+			*/
+			static constexpr double DEFAULT_DAMPING = 0.85;
+			/**
+			* Default convergence threshold: iteration stops when sum of absolute changes of scores falls below it.
+			*/
+			static constexpr double DEFAULT_TOLERANCE = 1e-9;
+			/**
+			* Default limit of iterations.
+			*/
+			static constexpr size_t DEFAULT_ITERATIONS = 100;
+
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			Centrality() = delete;
+
+			/**
+			* PageRank of every Node.
+			*
+			* Random surfer follows outgoing Edge with probability proportional to its' weight, or with probability 1-damping teleports to random Node. Surfer stuck in Node without outgoing edges always teleports.
+			* PageRank is stationary distribution of surfer's position, so scores sum up to 1.
+			*
+			* Computed by power iteration, pull-based: every Node sums contributions of its' incoming edges (from transposed graph with weights normalised by sum of outgoing weights of their sources), 
+			* so nodes are updated in parallel without atomics. Result doesn't depend on number of threads.
+			* \param graph Graph in CSR form. Weights MUST be non-negative.
+			* \param damping Probability of following an Edge. MUST belong to [0,1)
+			* \param tolerance Convergence threshold for sum of absolute changes of scores.
+			* \param max_iterations Limit of iterations.
+			* \param pool ThreadPool executing the algorithm.
+			* \return PageRank of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has negative weights or damping is out of range.
+			* \par Time complexity:
+			* \f$O(\frac{iterations * (nodes + edges)}{threads})\f$
+			*/
+			static std::vector<double> PageRank(const CompactGraph& graph, const double& damping = DEFAULT_DAMPING, const double& tolerance = DEFAULT_TOLERANCE, const size_t& max_iterations = DEFAULT_ITERATIONS, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Personalized PageRank: the same as PageRank(), but surfer teleports only to given source nodes (uniformly). Scores measure relevance of nodes to sources.
+			* \param graph Graph in CSR form. Weights MUST be non-negative.
+			* \param sources Nodes surfer teleports to. Duplicates increase probability of teleporting to given Node.
+			* \param damping Probability of following an Edge. MUST belong to [0,1)
+			* \param tolerance Convergence threshold for sum of absolute changes of scores.
+			* \param max_iterations Limit of iterations.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Personalized PageRank of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has negative weights, damping is out of range or sources are empty.
+			* \throws std::out_of_range if any of sources doesn't belong to graph.
+			* \par Time complexity:
+			* \f$O(\frac{iterations * (nodes + edges)}{threads})\f$
+			*/
+			static std::vector<double> PersonalizedPageRank(const CompactGraph& graph, const std::vector<Node>& sources, const double& damping = DEFAULT_DAMPING, const double& tolerance = DEFAULT_TOLERANCE, const size_t& max_iterations = DEFAULT_ITERATIONS, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Betweenness centrality of every Node: sum, over all pairs of other nodes (s,t), of fraction of shortest paths from s to t that pass through Node.
+			*
+			* Computed with Brandes algorithm: single-source shortest paths from every Node (Dijkstra-style settling for weighted graph, BFS for unweighted one), 
+			* followed by accumulation of dependencies in reverse order of settling. Sources are split into as many ranges as there are threads in pool, every range has its' own workspace and accumulator of scores, 
+			* and accumulators are added into the first one in order of ranges. Memory is one accumulator of nodes per thread, and result is the same for the same size of pool.
+			*
+			* Graph is treated as directed and scores aren't normalised. For undirected graph (stored with edges in both directions), divide scores by 2.
+			* \param graph Graph in CSR form. Weights MUST be positive if weighted is true.
+			* \param weighted If true, length of path is sum of weights, otherwise number of edges.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Betweenness of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has non-positive weights and weighted is true.
+			* \par Time complexity:
+			* \f$O(\frac{nodes * edges}{threads})\f$ unweighted, \f$O(\frac{nodes * edges * log(nodes)}{threads})\f$ weighted.
+			*/
+			static std::vector<double> Betweenness(const CompactGraph& graph, bool weighted = true, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Approximate betweenness centrality, computed from randomly sampled sources only and scaled by \f$\frac{nodes}{samples}\f$. Check Betweenness()
+			* \param graph Graph in CSR form. Weights MUST be positive if weighted is true.
+			* \param samples Number of sampled sources. If it's not lower than number of nodes, exact betweenness is computed.
+			* \param seed Seed of sampling.
+			* \param weighted If true, length of path is sum of weights, otherwise number of edges.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Estimated betweenness of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has non-positive weights and weighted is true, or samples is 0.
+			* \par Time complexity:
+			* \f$O(\frac{samples * edges}{threads})\f$ unweighted, \f$O(\frac{samples * edges * log(nodes)}{threads})\f$ weighted.
+			*/
+			static std::vector<double> ApproximateBetweenness(const CompactGraph& graph, const size_t& samples, const uint64_t& seed = 0, bool weighted = true, ThreadPool& pool = ThreadPool::Default());
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+
+#include <atomic>
+#include <vector>
+#include "clustering.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		// Both ranges sorted ascending. Branchless merge, so the loop is driven by data and not by branch predictor.
+		uint64_t CountCommon(const uint32_t* a, const uint32_t* a_end, const uint32_t* b, const uint32_t* b_end, std::vector<uint32_t>* common)
+		{
+			uint64_t count = 0;
+			while (a < a_end && b < b_end)
+			{
+				const uint32_t x = *a;
+				const uint32_t y = *b;
+				if (x == y && common) common->push_back(x);
+				count += (x == y);
+				a += (x <= y);
+				b += (y <= x);
+			}
+			return count;
+		}
+	}
+
+	void Clustering::Orient(const CompactGraph& graph, std::vector<size_t>& offsets, std::vector<uint32_t>& targets, std::vector<uint32_t>& degree)
+	{
+		const CompactGraph undirected = graph.Symmetrize();
+		const size_t n = undirected.size_nodes();
+		degree.assign(n, 0);
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = undirected.offsets()[i]; e < undirected.offsets()[i + 1]; ++e) { if (undirected.targets()[e] != i) degree[i]++; }
+		}
+		const auto lower = [&degree](const uint32_t& a, const uint32_t& b) { return degree[a] < degree[b] || (degree[a] == degree[b] && a < b); };
+		// Adjacency lists of symmetrized graph are sorted by index, so are the oriented ones
+		offsets.assign(n + 1, 0);
+		targets.clear();
+		targets.reserve(undirected.size_edges() / 2);
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = undirected.offsets()[i]; e < undirected.offsets()[i + 1]; ++e)
+			{
+				const uint32_t target = undirected.targets()[e];
+				if (lower(i, target)) targets.push_back(target);
+			}
+			offsets[i + 1] = targets.size();
+		}
+	}
+
+	std::vector<uint64_t> Clustering::Count(const std::vector<size_t>& offsets, const std::vector<uint32_t>& targets, ThreadPool& pool)
+	{
+		const size_t n = offsets.size() - 1;
+		std::vector<std::atomic<uint64_t>> counts(n);
+		pool.ParallelFor(0, n, 256, [&](size_t first, size_t last) {
+			std::vector<uint32_t> common;
+			for (size_t u = first; u < last; ++u)
+			{
+				uint64_t found = 0;
+				for (size_t e = offsets[u]; e < offsets[u + 1]; ++e)
+				{
+					const uint32_t v = targets[e];
+					common.clear();
+					const uint64_t count = CountCommon(targets.data() + offsets[u], targets.data() + offsets[u + 1], targets.data() + offsets[v], targets.data() + offsets[v + 1], &common);
+					if (count == 0) continue;
+					found = found + count;
+					counts[v].fetch_add(count, std::memory_order_relaxed);
+					for (const uint32_t& w : common) { counts[w].fetch_add(1, std::memory_order_relaxed); }
+				}
+				if (found) counts[u].fetch_add(found, std::memory_order_relaxed);
+			}
+		});
+		std::vector<uint64_t> output(n);
+		for (size_t i = 0; i < n; ++i) { output[i] = counts[i].load(std::memory_order_relaxed); }
+		return output;
+	}
+
+	std::vector<uint64_t> Clustering::Triangles(const CompactGraph& graph, ThreadPool& pool)
+	{
+		std::vector<size_t> offsets;
+		std::vector<uint32_t> targets;
+		std::vector<uint32_t> degree;
+		Clustering::Orient(graph, offsets, targets, degree);
+		return Clustering::Count(offsets, targets, pool);
+	}
+
+	std::vector<double> Clustering::LocalCoefficients(const CompactGraph& graph, ThreadPool& pool)
+	{
+		std::vector<size_t> offsets;
+		std::vector<uint32_t> targets;
+		std::vector<uint32_t> degree;
+		Clustering::Orient(graph, offsets, targets, degree);
+		const std::vector<uint64_t> triangles = Clustering::Count(offsets, targets, pool);
+		std::vector<double> output(triangles.size(), 0);
+		for (size_t i = 0; i < output.size(); ++i)
+		{
+			const double d = degree[i];
+			if (d >= 2) output[i] = 2.0 * triangles[i] / (d * (d - 1));
+		}
+		return output;
+	}
+
+	double Clustering::GlobalCoefficient(const CompactGraph& graph, ThreadPool& pool)
+	{
+		std::vector<size_t> offsets;
+		std::vector<uint32_t> targets;
+		std::vector<uint32_t> degree;
+		Clustering::Orient(graph, offsets, targets, degree);
+		const size_t n = degree.size();
+		// Every triangle is counted once, at its' lowest Node
+		const uint64_t triangles = pool.ParallelReduce<uint64_t>(0, n, 256, 0, [&](size_t first, size_t last) {
+			uint64_t sum = 0;
+			for (size_t u = first; u < last; ++u)
+			{
+				for (size_t e = offsets[u]; e < offsets[u + 1]; ++e)
+				{
+					const uint32_t v = targets[e];
+					sum = sum + CountCommon(targets.data() + offsets[u], targets.data() + offsets[u + 1], targets.data() + offsets[v], targets.data() + offsets[v + 1], nullptr);
+				}
+			}
+			return sum;
+		}, [](const uint64_t& l, const uint64_t& r) { return l + r; });
+		double triples = 0;
+		for (const uint32_t& d : degree) { triples = triples + (double)d * (d - 1) / 2; }
+		if (triples == 0) return 0;
+		return 3.0 * triangles / triples;
+	}
+}
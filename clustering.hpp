@@ -0,0 +1,74 @@
+#ifndef HWDG_CLUSTERING_HPP
+#define HWDG_CLUSTERING_HPP
+
+/**
+* @file clustering.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Triangle counting and clustering coefficients.
+*
+* This file contains Clustering class, which counts triangles of CompactGraph and computes clustering coefficients.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class containing triangle counting and clustering coefficients.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* All functions work on underlying undirected structure of the graph: direction and weight of edges are ignored, edges in both directions count as one, and loops are skipped.
+	* Results are indexed by CompactGraph::index()
+	*/
+	class Clustering
+	{
+		private:
+			static void Orient(const CompactGraph& graph, std::vector<size_t>& offsets, std::vector<uint32_t>& targets, std::vector<uint32_t>& degree);
+			static std::vector<uint64_t> Count(const std::vector<size_t>& offsets, const std::vector<uint32_t>& targets, ThreadPool& pool);
+		public:
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			Clustering() = delete;
+
+			/**
+			* Number of triangles every Node belongs to.
+			*
+			* Every undirected edge is oriented from Node of lower degree to Node of higher one (ties broken by index), so every Node has at most \f$O(\sqrt{edges})\f$ outgoing edges.
+			* Triangles are found by intersecting sorted lists of outgoing neighbours of both ends of every oriented edge, each triangle exactly once. Nodes are processed in parallel.
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Number of triangles for every Node.
+			* \par Time complexity:
+			* \f$O(\frac{edges^{1.5}}{threads})\f$
+			*/
+			static std::vector<uint64_t> Triangles(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Local clustering coefficient of every Node: fraction of pairs of its' neighbours that are connected, \f$ C_v = \frac{2 T_v}{d_v (d_v - 1)} \f$
+			* Nodes with fewer than 2 neighbours have coefficient 0.
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Clustering coefficient, belongs to [0,1], for every Node.
+			* \par Time complexity:
+			* \f$O(\frac{edges^{1.5}}{threads})\f$
+			*/
+			static std::vector<double> LocalCoefficients(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Global clustering coefficient (transitivity): \f$ \frac{3 * triangles}{connected\ triples} \f$
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Global clustering coefficient, belongs to [0,1]. 0 if there're no connected triples.
+			* \par Time complexity:
+			* \f$O(\frac{edges^{1.5}}{threads})\f$
+			*/
+			static double GlobalCoefficient(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+	};
+}
+
+#endif
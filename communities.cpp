@@ -0,0 +1,306 @@
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "communities.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		constexpr uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+
+		// Symmetric weighted adjacency. Loop of node i is stored once, in list of i.
+		struct Undirected
+		{
+			std::vector<size_t> offsets;
+			std::vector<uint32_t> targets;
+			std::vector<double> weights;
+
+			size_t size(void) const { return offsets.size() - 1; }
+
+			// Weighted degree, loop counts twice
+			double degree(const uint32_t& node) const
+			{
+				double sum = 0;
+				for (size_t e = offsets[node]; e < offsets[node + 1]; ++e) { sum = sum + ((targets[e] == node) ? 2 * weights[e] : weights[e]); }
+				return sum;
+			}
+		};
+
+		// Builds adjacency from list of (source, target, weight), merging duplicates. Every connection must be listed from both sides, except loops.
+		Undirected Build(const size_t& n, std::vector<std::pair<std::pair<uint32_t, uint32_t>, double>>& connections)
+		{
+			std::sort(connections.begin(), connections.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+			Undirected output;
+			output.offsets.assign(n + 1, 0);
+			for (size_t i = 0; i < connections.size(); ++i)
+			{
+				const auto& connection = connections[i];
+				if (i && connections[i - 1].first == connection.first) { output.weights.back() = output.weights.back() + connection.second; continue; }
+				output.targets.push_back(connection.first.second);
+				output.weights.push_back(connection.second);
+				output.offsets[connection.first.first + 1]++;
+			}
+			for (size_t i = 0; i < n; ++i) { output.offsets[i + 1] += output.offsets[i]; }
+			return output;
+		}
+
+		Undirected FromGraph(const CompactGraph& graph)
+		{
+			std::vector<std::pair<std::pair<uint32_t, uint32_t>, double>> connections;
+			connections.reserve(2 * graph.size_edges());
+			for (uint32_t i = 0; i < graph.size_nodes(); ++i)
+			{
+				for (size_t e = graph.offsets()[i]; e < graph.offsets()[i + 1]; ++e)
+				{
+					const uint32_t target = graph.targets()[e];
+					const double weight = graph.weights()[e];
+					if (weight < 0) throw std::invalid_argument("Communities: graph has negative weights");
+					connections.push_back({ { i, target }, weight });
+					if (target != i) connections.push_back({ { target, i }, weight });
+				}
+			}
+			return Build(graph.size_nodes(), connections);
+		}
+
+		void Canonicalize(std::vector<uint32_t>& labels)
+		{
+			std::vector<uint32_t> renamed(labels.size(), UNASSIGNED);
+			uint32_t next = 0;
+			for (uint32_t& label : labels)
+			{
+				if (renamed[label] == UNASSIGNED) renamed[label] = next++;
+				label = renamed[label];
+			}
+		}
+
+		// Labels given by user may be arbitrary numbers, so they're renamed to 0..count-1 in order of first appearance.
+		// Returns renamed labels, and original label of every community in names.
+		std::vector<uint32_t> Renumber(const std::vector<uint32_t>& labels, std::vector<uint32_t>& names)
+		{
+			std::unordered_map<uint32_t, uint32_t> renamed;
+			std::vector<uint32_t> output(labels.size());
+			names.clear();
+			for (size_t i = 0; i < labels.size(); ++i)
+			{
+				const auto inserted = renamed.emplace(labels[i], (uint32_t)names.size());
+				if (inserted.second) names.push_back(labels[i]);
+				output[i] = inserted.first->second;
+			}
+			return output;
+		}
+
+		void CheckLabels(const CompactGraph& graph, const std::vector<uint32_t>& labels)
+		{
+			if (labels.size() != graph.size_nodes()) throw std::invalid_argument(Tools::string_format("Communities: %zu labels given for graph with %zu nodes", labels.size(), graph.size_nodes()));
+		}
+	}
+
+	std::vector<uint32_t> Communities::LabelPropagation(const CompactGraph& graph, const size_t& max_iterations, ThreadPool& pool)
+	{
+		const Undirected adjacency = FromGraph(graph);
+		const size_t n = adjacency.size();
+		std::vector<uint32_t> labels(n);
+		for (uint32_t i = 0; i < n; ++i) { labels[i] = i; }
+
+		// Greedy colouring in order of indices. Nodes of the same colour aren't adjacent, so they can be updated in place and in parallel.
+		std::vector<uint32_t> colour(n, UNASSIGNED);
+		std::vector<size_t> forbidden;
+		uint32_t colours = 0;
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = adjacency.offsets[i]; e < adjacency.offsets[i + 1]; ++e)
+			{
+				const uint32_t neighbour_colour = colour[adjacency.targets[e]];
+				if (neighbour_colour != UNASSIGNED) forbidden[neighbour_colour] = i;
+			}
+			uint32_t chosen = 0;
+			while (chosen < colours && forbidden[chosen] == i) { chosen++; }
+			if (chosen == colours) { colours++; forbidden.push_back(UNASSIGNED); }
+			colour[i] = chosen;
+		}
+		// Nodes grouped by colour, in order of indices within every group
+		std::vector<size_t> class_offsets(colours + 1, 0);
+		for (uint32_t i = 0; i < n; ++i) { class_offsets[colour[i] + 1]++; }
+		for (uint32_t c = 0; c < colours; ++c) { class_offsets[c + 1] += class_offsets[c]; }
+		std::vector<uint32_t> order(n);
+		std::vector<size_t> position(class_offsets.begin(), class_offsets.end() - 1);
+		for (uint32_t i = 0; i < n; ++i) { order[position[colour[i]]++] = i; }
+
+		for (size_t iteration = 0; iteration < max_iterations; ++iteration)
+		{
+			size_t changed = 0;
+			for (uint32_t c = 0; c < colours; ++c)
+			{
+				changed += pool.ParallelReduce<size_t>(class_offsets[c], class_offsets[c + 1], 512, 0, [&](size_t first, size_t last) {
+					size_t count = 0;
+					std::vector<std::pair<uint32_t, double>> votes;
+					for (size_t o = first; o < last; ++o)
+					{
+						const uint32_t i = order[o];
+						votes.clear();
+						for (size_t e = adjacency.offsets[i]; e < adjacency.offsets[i + 1]; ++e)
+						{
+							if (adjacency.targets[e] != i) votes.push_back({ labels[adjacency.targets[e]], adjacency.weights[e] });
+						}
+						if (votes.empty()) continue;
+						std::sort(votes.begin(), votes.end());
+						double best_weight = -1;
+						double own_weight = -1;
+						uint32_t best = labels[i];
+						for (size_t v = 0; v < votes.size();)
+						{
+							const uint32_t label = votes[v].first;
+							double weight = 0;
+							for (; v < votes.size() && votes[v].first == label; ++v) { weight = weight + votes[v].second; }
+							if (label == labels[i]) own_weight = weight;
+							if (weight > best_weight) { best_weight = weight; best = label; }
+						}
+						if (own_weight >= best_weight) best = labels[i];
+						if (best != labels[i]) { labels[i] = best; count++; }
+					}
+					return count;
+				}, [](const size_t& l, const size_t& r) { return l + r; });
+			}
+			if (changed == 0) break;
+		}
+		Canonicalize(labels);
+		return labels;
+	}
+
+	std::vector<uint32_t> Communities::Louvain(const CompactGraph& graph, const double& resolution)
+	{
+		Undirected level = FromGraph(graph);
+		// Community of every original node, expressed as node of current level
+		std::vector<uint32_t> membership(graph.size_nodes());
+		for (uint32_t i = 0; i < membership.size(); ++i) { membership[i] = i; }
+		double total = 0;
+		for (uint32_t i = 0; i < level.size(); ++i) { total = total + level.degree(i); }
+		if (total == 0) return membership;
+
+		while (true)
+		{
+			const size_t n = level.size();
+			std::vector<double> degree(n);
+			for (uint32_t i = 0; i < n; ++i) { degree[i] = level.degree(i); }
+			std::vector<uint32_t> community(n);
+			std::vector<double> community_degree = degree;
+			for (uint32_t i = 0; i < n; ++i) { community[i] = i; }
+
+			// Local moving
+			std::vector<double> weight_to(n, 0);
+			std::vector<uint32_t> touched;
+			bool moved_any = false;
+			bool moved = true;
+			while (moved)
+			{
+				moved = false;
+				for (uint32_t i = 0; i < n; ++i)
+				{
+					const uint32_t own = community[i];
+					touched.clear();
+					touched.push_back(own);
+					for (size_t e = level.offsets[i]; e < level.offsets[i + 1]; ++e)
+					{
+						const uint32_t target = level.targets[e];
+						if (target == i) continue;
+						const uint32_t c = community[target];
+						if (weight_to[c] == 0 && c != own) touched.push_back(c);
+						weight_to[c] = weight_to[c] + level.weights[e];
+					}
+					// Gain of moving isolated node i into community c: weight_to[c] - resolution * degree[c] * degree[i] / total
+					community_degree[own] = community_degree[own] - degree[i];
+					uint32_t best = own;
+					double best_gain = weight_to[own] - resolution * community_degree[own] * degree[i] / total;
+					for (const uint32_t& c : touched)
+					{
+						const double gain = weight_to[c] - resolution * community_degree[c] * degree[i] / total;
+						if (gain > best_gain + 1e-12) { best_gain = gain; best = c; }
+					}
+					community_degree[best] = community_degree[best] + degree[i];
+					for (const uint32_t& c : touched) { weight_to[c] = 0; }
+					if (best != own)
+					{
+						community[i] = best;
+						moved = true;
+						moved_any = true;
+					}
+				}
+			}
+			if (!moved_any) break;
+
+			// Aggregation
+			Canonicalize(community);
+			const size_t count = *std::max_element(community.begin(), community.end()) + 1;
+			std::vector<std::pair<std::pair<uint32_t, uint32_t>, double>> connections;
+			connections.reserve(level.targets.size());
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				for (size_t e = level.offsets[i]; e < level.offsets[i + 1]; ++e)
+				{
+					const uint32_t target = level.targets[e];
+					const uint32_t a = community[i];
+					const uint32_t b = community[target];
+					// Connection within community is seen from both of its' ends, loop only once
+					if (a == b) connections.push_back({ { a, a }, (target == i) ? level.weights[e] : level.weights[e] / 2 });
+					else connections.push_back({ { a, b }, level.weights[e] });
+				}
+			}
+			level = Build(count, connections);
+			for (uint32_t& member : membership) { member = community[member]; }
+		}
+		Canonicalize(membership);
+		return membership;
+	}
+
+	double Communities::Modularity(const CompactGraph& graph, const std::vector<uint32_t>& labels, const double& resolution)
+	{
+		CheckLabels(graph, labels);
+		const Undirected adjacency = FromGraph(graph);
+		std::vector<uint32_t> names;
+		const std::vector<uint32_t> community = Renumber(labels, names);
+		const size_t count = names.size();
+		std::vector<double> internal(count, 0);
+		std::vector<double> degree(count, 0);
+		double total = 0;
+		for (uint32_t i = 0; i < adjacency.size(); ++i)
+		{
+			const double d = adjacency.degree(i);
+			degree[community[i]] = degree[community[i]] + d;
+			total = total + d;
+			for (size_t e = adjacency.offsets[i]; e < adjacency.offsets[i + 1]; ++e)
+			{
+				if (community[adjacency.targets[e]] == community[i]) internal[community[i]] = internal[community[i]] + ((adjacency.targets[e] == i) ? 2 * adjacency.weights[e] : adjacency.weights[e]);
+			}
+		}
+		if (total == 0) return 0;
+		double output = 0;
+		for (size_t c = 0; c < count; ++c)
+		{
+			output = output + internal[c] / total - resolution * (degree[c] / total) * (degree[c] / total);
+		}
+		return output;
+	}
+
+	Graph Communities::Aggregate(const CompactGraph& graph, const std::vector<uint32_t>& labels)
+	{
+		CheckLabels(graph, labels);
+		std::vector<uint32_t> names;
+		Renumber(labels, names);
+		Graph output;
+		output.reserve_nodes(names.size());
+		for (const uint32_t& label : names) { output.add(Node(label)); }
+		for (uint32_t i = 0; i < graph.size_nodes(); ++i)
+		{
+			for (size_t e = graph.offsets()[i]; e < graph.offsets()[i + 1]; ++e)
+			{
+				output.accumulate(Edge(Node(labels[i]), Node(labels[graph.targets()[e]]), graph.weights()[e]));
+			}
+		}
+		return output;
+	}
+}
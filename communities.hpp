@@ -0,0 +1,100 @@
+#ifndef HWDG_COMMUNITIES_HPP
+#define HWDG_COMMUNITIES_HPP
+
+/**
+* @file communities.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Community detection.
+*
+* This file contains Communities class, which partitions nodes of CompactGraph into densely connected groups.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class containing community detection algorithms.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* Algorithms work on undirected structure of the graph, weight of connection between two nodes is sum of weights of edges in both directions. Weights MUST be non-negative.
+	* Communities are returned as array of labels indexed by CompactGraph::index(), dense (0..count-1) and numbered in order of their lowest node index, like in Components.
+	*/
+	class Communities
+	{
+		public:
+			/**
+			* Default limit of iterations of LabelPropagation()
+			*/
+			static constexpr size_t DEFAULT_ITERATIONS = 20;
+
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			Communities() = delete;
+
+			/**
+			* Community detection by label propagation.
+			*
+			* Every Node starts in its' own community, then in every iteration it joins community with the highest total weight of connections to it. 
+			* Iterations are semi-synchronous: nodes are split into classes by greedy colouring, classes are updated one after another, and nodes of one class (never adjacent to each other) in parallel. 
+			* Thanks to that result doesn't depend on number of threads, and labels don't oscillate on bipartite structures like they do with fully synchronous updates.
+			* Ties are broken in favour of current label, then the lowest one.
+			* \param graph Graph in CSR form.
+			* \param max_iterations Limit of iterations. Algorithm stops earlier if no label changes.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Community of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has negative weights.
+			* \par Time complexity:
+			* \f$O(edges + iterations * (\frac{edges * log(degree)}{threads} + colours))\f$
+			*/
+			static std::vector<uint32_t> LabelPropagation(const CompactGraph& graph, const size_t& max_iterations = DEFAULT_ITERATIONS, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Community detection by Louvain modularity optimisation.
+			*
+			* Nodes are moved one by one to neighbouring community that increases modularity the most, until no move helps. Then every community is aggregated into single Node, 
+			* and the process is repeated on aggregated graph, until communities stop changing.
+			* \param graph Graph in CSR form.
+			* \param resolution Resolution of modularity. Values above 1 favour smaller communities, below 1 - bigger ones.
+			* \return Community of every Node, indexed by CompactGraph::index()
+			* \throws std::invalid_argument if graph has negative weights.
+			* \par Time complexity:
+			* \f$O(edges * log(nodes))\f$ in practice.
+			*/
+			static std::vector<uint32_t> Louvain(const CompactGraph& graph, const double& resolution = 1.0);
+
+			/**
+			* Modularity of partition: \f$ Q = \sum_c \left( \frac{w_c}{m} - \gamma \left( \frac{d_c}{2m} \right)^2 \right) \f$
+			*
+			* where \f$w_c\f$ is weight of connections within community c, \f$d_c\f$ is total weighted degree of its' nodes, \f$m\f$ is weight of all connections and \f$\gamma\f$ is resolution.
+			* \param graph Graph in CSR form.
+			* \param labels Community of every Node. Labels don't have to be consecutive numbers.
+			* \param resolution Resolution of modularity.
+			* \return Modularity, belongs to [-0.5,1] for resolution 1.
+			* \throws std::invalid_argument if number of labels is different from number of nodes.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static double Modularity(const CompactGraph& graph, const std::vector<uint32_t>& labels, const double& resolution = 1.0);
+
+			/**
+			* Build graph of communities: every community becomes single Node (with identifier equal to its' label), and weights of edges between communities are added, 
+			* as in Operations::Union(const Graph&, const Graph&). Edges within community become loop of its' Node. Only labels present in labels become nodes.
+			* \param graph Graph in CSR form.
+			* \param labels Community of every Node. Labels don't have to be consecutive numbers.
+			* \return Graph of communities.
+			* \throws std::invalid_argument if number of labels is different from number of nodes.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static Graph Aggregate(const CompactGraph& graph, const std::vector<uint32_t>& labels);
+	};
+}
+
+#endif
@@ -0,0 +1,176 @@
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "compact_graph.hpp"
+#include "node_in_graph.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	CompactGraph::CompactGraph() : _offsets(1, 0) {}
+
+	void CompactGraph::Link(void)
+	{
+		this->_index.clear();
+		this->_index.reserve(this->_ids.size());
+		for (uint32_t i = 0; i < this->_ids.size(); ++i) { this->_index.insert({ this->_ids[i], i }); }
+	}
+
+	CompactGraph::CompactGraph(const Graph& graph)
+	{
+		this->_ids.reserve(graph.size_nodes());
+		for (const NodeInGraph& node : graph) { this->_ids.push_back(node.id()); }
+		std::sort(this->_ids.begin(), this->_ids.end());
+		this->Link();
+
+		this->_offsets.resize(this->_ids.size() + 1, 0);
+		this->_targets.reserve(graph.size_edges());
+		this->_weights.reserve(graph.size_edges());
+		std::vector<std::pair<uint32_t, float>> adjacency;
+		for (uint32_t i = 0; i < this->_ids.size(); ++i)
+		{
+			adjacency.clear();
+			for (const Edge& edge : graph.fetch(Node(this->_ids[i])))
+			{
+				adjacency.push_back({ this->_index.at(edge.target().id()), edge.weight() });
+			}
+			std::sort(adjacency.begin(), adjacency.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+			for (const auto& pair : adjacency)
+			{
+				this->_targets.push_back(pair.first);
+				this->_weights.push_back(pair.second);
+			}
+			this->_offsets[i + 1] = this->_targets.size();
+		}
+	}
+
+	Graph CompactGraph::ToGraph(void) const
+	{
+		Graph output;
+		output.reserve_nodes(this->size_nodes());
+		output.reserve_edges(this->size_edges());
+		for (const uint32_t& id : this->_ids) { output.add(Node(id)); }
+		for (uint32_t i = 0; i < this->_ids.size(); ++i)
+		{
+			output.reserve_edges_in_node(Node(this->_ids[i]), this->degree(i));
+			for (size_t e = this->_offsets[i]; e < this->_offsets[i + 1]; ++e)
+			{
+				output.add(Edge(Node(this->_ids[i]), Node(this->_ids[this->_targets[e]]), this->_weights[e]));
+			}
+		}
+		return output;
+	}
+
+	size_t CompactGraph::size_nodes(void) const
+	{
+		return this->_ids.size();
+	}
+
+	size_t CompactGraph::size_edges(void) const
+	{
+		return this->_targets.size();
+	}
+
+	bool CompactGraph::has(const Node& node) const
+	{
+		return this->_index.find(node.id()) != this->_index.end();
+	}
+
+	uint32_t CompactGraph::index(const Node& node) const
+	{
+		auto iter = this->_index.find(node.id());
+		if (iter == this->_index.end()) throw std::out_of_range(Tools::string_format("Node %s doesn't belong to given graph", node.str().c_str()));
+		return iter->second;
+	}
+
+	Node CompactGraph::node(const uint32_t& index) const
+	{
+		return Node(this->_ids[index]);
+	}
+
+	size_t CompactGraph::degree(const uint32_t& index) const
+	{
+		return this->_offsets[index + 1] - this->_offsets[index];
+	}
+
+	const std::vector<uint32_t>& CompactGraph::ids(void) const
+	{
+		return this->_ids;
+	}
+
+	const std::vector<size_t>& CompactGraph::offsets(void) const
+	{
+		return this->_offsets;
+	}
+
+	const std::vector<uint32_t>& CompactGraph::targets(void) const
+	{
+		return this->_targets;
+	}
+
+	const std::vector<float>& CompactGraph::weights(void) const
+	{
+		return this->_weights;
+	}
+
+	CompactGraph CompactGraph::Transpose(void) const
+	{
+		// Counting sort by target. Sources are visited in ascending order, so adjacency lists of output are sorted as well
+		CompactGraph output;
+		output._ids = this->_ids;
+		output._index = this->_index;
+		output._offsets.assign(this->size_nodes() + 1, 0);
+		output._targets.resize(this->size_edges());
+		output._weights.resize(this->size_edges());
+		for (const uint32_t& target : this->_targets) { output._offsets[target + 1]++; }
+		for (size_t i = 0; i < this->size_nodes(); ++i) { output._offsets[i + 1] += output._offsets[i]; }
+		std::vector<size_t> position(output._offsets.begin(), output._offsets.end() - 1);
+		for (uint32_t i = 0; i < this->size_nodes(); ++i)
+		{
+			for (size_t e = this->_offsets[i]; e < this->_offsets[i + 1]; ++e)
+			{
+				const size_t slot = position[this->_targets[e]]++;
+				output._targets[slot] = i;
+				output._weights[slot] = this->_weights[e];
+			}
+		}
+		return output;
+	}
+
+	CompactGraph CompactGraph::Symmetrize(void) const
+	{
+		// Both adjacency lists of every node are sorted by target, so they can be merged
+		const CompactGraph transposed = this->Transpose();
+		CompactGraph output;
+		output._ids = this->_ids;
+		output._index = this->_index;
+		output._offsets.assign(this->size_nodes() + 1, 0);
+		output._targets.reserve(2 * this->size_edges());
+		output._weights.reserve(2 * this->size_edges());
+		for (uint32_t i = 0; i < this->size_nodes(); ++i)
+		{
+			size_t a = this->_offsets[i];
+			size_t b = transposed._offsets[i];
+			const size_t a_end = this->_offsets[i + 1];
+			const size_t b_end = transposed._offsets[i + 1];
+			while (a < a_end || b < b_end)
+			{
+				if (b == b_end || (a < a_end && this->_targets[a] < transposed._targets[b]))
+				{
+					output._targets.push_back(this->_targets[a]); output._weights.push_back(this->_weights[a]); a++;
+				}
+				else if (a == a_end || transposed._targets[b] < this->_targets[a])
+				{
+					output._targets.push_back(transposed._targets[b]); output._weights.push_back(transposed._weights[b]); b++;
+				}
+				else
+				{
+					output._targets.push_back(this->_targets[a]); output._weights.push_back(std::min(this->_weights[a], transposed._weights[b])); a++; b++;
+				}
+			}
+			output._offsets[i + 1] = output._targets.size();
+		}
+		return output;
+	}
+}
@@ -0,0 +1,151 @@
+#ifndef HWDG_COMPACT_GRAPH_HPP
+#define HWDG_COMPACT_GRAPH_HPP
+
+/**
+* @file compact_graph.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Compressed sparse row (CSR) snapshot of Graph.
+*
+* This file contains CompactGraph class, immutable snapshot of Graph used by whole-graph analytics (components, centrality and others).
+*/
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace HWDG
+{
+	/**
+	* Immutable snapshot of Graph in compressed sparse row (CSR) form.
+	*
+	* Nodes are renumbered to dense indices 0..size_nodes()-1, in ascending order of Node::id(). Edges coming out from node with index i are stored
+	* at positions [offsets()[i], offsets()[i+1]) of targets() and weights(), sorted by index of target. 
+	* Algorithms that visit every edge many times (components, centrality, flows) run over contiguous arrays instead of hash maps.
+	*/
+	class CompactGraph
+	{
+		private:
+			std::vector<uint32_t> _ids;
+			std::unordered_map<uint32_t, uint32_t> _index;
+			std::vector<size_t> _offsets;
+			std::vector<uint32_t> _targets;
+			std::vector<float> _weights;
+		private:
+			void Link(void);
+		public:
+			/**
+			* Create empty snapshot.
+			*/
+			CompactGraph();
+
+			/**
+			* Create snapshot of the Graph.
+			* \param graph Graph to be converted.
+			* \par Time complexity:
+			* \f$O(nodes * log(nodes) + edges * log(degree))\f$
+			*/
+			CompactGraph(const Graph& graph);
+
+			/**
+			* Convert snapshot back to Graph.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			Graph ToGraph(void) const;
+
+			/**
+			* Get number of nodes.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_nodes(void) const;
+
+			/**
+			* Get number of edges.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_edges(void) const;
+
+			/**
+			* Check whether Node belongs to snapshot.
+			* \param node Node to be checked.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			bool has(const Node& node) const;
+
+			/**
+			* Get dense index of the Node.
+			* \param node Node that belongs to snapshot.
+			* \throws std::out_of_range if Node doesn't belong to snapshot.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			uint32_t index(const Node& node) const;
+
+			/**
+			* Get Node with given dense index.
+			* \param index Index, MUST be lower than size_nodes()
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			Node node(const uint32_t& index) const;
+
+			/**
+			* Get number of edges coming out from node with given index.
+			* \param index Index, MUST be lower than size_nodes()
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t degree(const uint32_t& index) const;
+
+			/**
+			* Get identifiers of nodes, indexed by dense index.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<uint32_t>& ids(void) const;
+
+			/**
+			* Get offsets of adjacency lists, size_nodes()+1 elements.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<size_t>& offsets(void) const;
+
+			/**
+			* Get indices of targets of edges.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<uint32_t>& targets(void) const;
+
+			/**
+			* Get weights of edges.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<float>& weights(void) const;
+
+			/**
+			* Create snapshot with direction of every edge reversed. Equivalent of Graph::Transpose()
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			CompactGraph Transpose(void) const;
+
+			/**
+			* Create snapshot in which every edge exists in both directions. If edge existed in both directions already, the lower weight is kept.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			CompactGraph Symmetrize(void) const;
+	};
+}
+
+#endif
@@ -0,0 +1,319 @@
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "components.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		constexpr uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+
+		// State shared by tasks of forward-backward algorithm. Subsets are disjoint, but BFS of one subset reads colors of neighbours that may belong to another one, hence atomics.
+		struct ForwardBackward
+		{
+			const CompactGraph& forward;
+			const CompactGraph& backward;
+			std::vector<std::atomic<uint32_t>> color;
+			std::vector<uint32_t>& labels;
+			std::atomic<uint32_t> next_color;
+			std::atomic<uint32_t> next_label;
+			ThreadPool& pool;
+			ThreadPool::TaskGroup group;
+
+			ForwardBackward(const CompactGraph& f, const CompactGraph& b, std::vector<uint32_t>& l, ThreadPool& p)
+				: forward(f), backward(b), color(f.size_nodes()), labels(l), next_color(1), next_label(0), pool(p) {}
+
+			// Mark all nodes of color 'from' reachable from pivot with color 'to'
+			void Reach(const CompactGraph& graph, const uint32_t& pivot, const uint32_t& from, const uint32_t& to, std::vector<uint32_t>& reached)
+			{
+				reached.clear();
+				reached.push_back(pivot);
+				this->color[pivot].store(to, std::memory_order_relaxed);
+				for (size_t i = 0; i < reached.size(); ++i)
+				{
+					const uint32_t current = reached[i];
+					for (size_t e = graph.offsets()[current]; e < graph.offsets()[current + 1]; ++e)
+					{
+						const uint32_t target = graph.targets()[e];
+						if (this->color[target].load(std::memory_order_relaxed) != from) continue;
+						this->color[target].store(to, std::memory_order_relaxed);
+						reached.push_back(target);
+					}
+				}
+			}
+
+			void Solve(std::vector<uint32_t> members, const uint32_t& own_color)
+			{
+				constexpr size_t spawn_threshold = 1024;
+				std::vector<std::pair<std::vector<uint32_t>, uint32_t>> pending;
+				pending.push_back({ std::move(members), own_color });
+				std::vector<uint32_t> reached;
+				while (pending.size())
+				{
+					std::vector<uint32_t> subset = std::move(pending.back().first);
+					const uint32_t c = pending.back().second;
+					pending.pop_back();
+					if (subset.empty()) continue;
+					const uint32_t pivot = subset.front();
+					// Forward: nodes of color c reachable from pivot get color fw
+					const uint32_t fw = this->next_color++;
+					this->Reach(this->forward, pivot, c, fw, reached);
+					// Backward, over nodes of color fw (component) and color c (reached only backwards)
+					const uint32_t label = this->next_label++;
+					const uint32_t bw = this->next_color++;
+					reached.clear();
+					reached.push_back(pivot);
+					this->color[pivot].store(UNASSIGNED, std::memory_order_relaxed);
+					this->labels[pivot] = label;
+					for (size_t i = 0; i < reached.size(); ++i)
+					{
+						const uint32_t current = reached[i];
+						for (size_t e = this->backward.offsets()[current]; e < this->backward.offsets()[current + 1]; ++e)
+						{
+							const uint32_t target = this->backward.targets()[e];
+							const uint32_t target_color = this->color[target].load(std::memory_order_relaxed);
+							if (target_color == fw)
+							{
+								this->color[target].store(UNASSIGNED, std::memory_order_relaxed);
+								this->labels[target] = label;
+							}
+							else if (target_color == c)
+							{
+								this->color[target].store(bw, std::memory_order_relaxed);
+							}
+							else continue;
+							reached.push_back(target);
+						}
+					}
+					// Split what's left into three subsets
+					std::vector<uint32_t> only_forward;
+					std::vector<uint32_t> only_backward;
+					std::vector<uint32_t> remaining;
+					for (const uint32_t& node : subset)
+					{
+						const uint32_t node_color = this->color[node].load(std::memory_order_relaxed);
+						if (node_color == fw) only_forward.push_back(node);
+						else if (node_color == bw) only_backward.push_back(node);
+						else if (node_color == c) remaining.push_back(node);
+					}
+					std::pair<std::vector<uint32_t>, uint32_t> parts[3] = { { std::move(only_forward), fw }, { std::move(only_backward), bw }, { std::move(remaining), c } };
+					for (auto& part : parts)
+					{
+						if (part.first.size() >= spawn_threshold)
+						{
+							auto shared = std::make_shared<std::pair<std::vector<uint32_t>, uint32_t>>(std::move(part));
+							this->pool.Spawn(this->group, [this, shared]() { this->Solve(std::move(shared->first), shared->second); });
+						}
+						else pending.push_back(std::move(part));
+					}
+				}
+			}
+		};
+
+		// Lock-free disjoint set forest. Parent of every root is the root itself, lower index always becomes parent of higher one.
+		class ConcurrentDisjointSet
+		{
+			private:
+				std::vector<std::atomic<uint32_t>> _parent;
+			public:
+				ConcurrentDisjointSet(const size_t& size) : _parent(size)
+				{
+					for (uint32_t i = 0; i < size; ++i) { this->_parent[i].store(i, std::memory_order_relaxed); }
+				}
+
+				uint32_t Find(uint32_t x)
+				{
+					while (true)
+					{
+						uint32_t parent = this->_parent[x].load(std::memory_order_relaxed);
+						if (parent == x) return x;
+						// Path halving: if it fails, another thread has already shortened the path
+						uint32_t grandparent = this->_parent[parent].load(std::memory_order_relaxed);
+						if (parent != grandparent) this->_parent[x].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+						x = grandparent;
+					}
+				}
+
+				void Union(uint32_t a, uint32_t b)
+				{
+					while (true)
+					{
+						a = this->Find(a);
+						b = this->Find(b);
+						if (a == b) return;
+						if (a < b) std::swap(a, b);
+						// a is the higher root - link it below b, unless another thread has linked it somewhere already
+						uint32_t expected = a;
+						if (this->_parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) return;
+					}
+				}
+		};
+	}
+
+	void Components::Canonicalize(std::vector<uint32_t>& labels)
+	{
+		std::vector<uint32_t> renamed(labels.size(), UNASSIGNED);
+		uint32_t next = 0;
+		for (uint32_t& label : labels)
+		{
+			if (renamed[label] == UNASSIGNED) renamed[label] = next++;
+			label = renamed[label];
+		}
+	}
+
+	std::vector<uint32_t> Components::StronglyConnected(const CompactGraph& graph)
+	{
+		const size_t n = graph.size_nodes();
+		const auto& offsets = graph.offsets();
+		const auto& targets = graph.targets();
+		std::vector<uint32_t> labels(n, UNASSIGNED);
+		std::vector<uint32_t> order(n, UNASSIGNED);
+		std::vector<uint32_t> lowlink(n, 0);
+		std::vector<uint32_t> stack;
+		// Call stack of recursive version: node and position of next edge to be visited
+		std::vector<std::pair<uint32_t, size_t>> calls;
+		uint32_t counter = 0;
+		uint32_t next_label = 0;
+
+		for (uint32_t root = 0; root < n; ++root)
+		{
+			if (order[root] != UNASSIGNED) continue;
+			order[root] = lowlink[root] = counter++;
+			stack.push_back(root);
+			calls.push_back({ root, offsets[root] });
+			while (calls.size())
+			{
+				const uint32_t current = calls.back().first;
+				size_t& position = calls.back().second;
+				if (position < offsets[current + 1])
+				{
+					const uint32_t target = targets[position++];
+					if (order[target] == UNASSIGNED)
+					{
+						order[target] = lowlink[target] = counter++;
+						stack.push_back(target);
+						calls.push_back({ target, offsets[target] });
+					}
+					else if (labels[target] == UNASSIGNED)
+					{
+						// Target is still on stack
+						lowlink[current] = std::min(lowlink[current], order[target]);
+					}
+					continue;
+				}
+				// All edges visited - return from "recursive call"
+				calls.pop_back();
+				if (calls.size()) lowlink[calls.back().first] = std::min(lowlink[calls.back().first], lowlink[current]);
+				if (lowlink[current] != order[current]) continue;
+				uint32_t member = UNASSIGNED;
+				do
+				{
+					member = stack.back();
+					stack.pop_back();
+					labels[member] = next_label;
+				} while (member != current);
+				next_label++;
+			}
+		}
+		Components::Canonicalize(labels);
+		return labels;
+	}
+
+	std::vector<uint32_t> Components::ParallelStronglyConnected(const CompactGraph& graph, ThreadPool& pool)
+	{
+		const size_t n = graph.size_nodes();
+		const CompactGraph transposed = graph.Transpose();
+		std::vector<uint32_t> labels(n, UNASSIGNED);
+		ForwardBackward state(graph, transposed, labels, pool);
+
+		// Trimming: nodes without incoming or outgoing edges (within remaining nodes) are components on their own
+		std::vector<uint32_t> in_degree(n);
+		std::vector<uint32_t> out_degree(n);
+		std::vector<uint32_t> trimmed;
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			out_degree[i] = (uint32_t)graph.degree(i);
+			in_degree[i] = (uint32_t)transposed.degree(i);
+			if (in_degree[i] == 0 || out_degree[i] == 0) trimmed.push_back(i);
+		}
+		for (const uint32_t& i : trimmed) { labels[i] = state.next_label++; }
+		for (size_t t = 0; t < trimmed.size(); ++t)
+		{
+			const uint32_t current = trimmed[t];
+			for (size_t e = graph.offsets()[current]; e < graph.offsets()[current + 1]; ++e)
+			{
+				const uint32_t target = graph.targets()[e];
+				if (labels[target] != UNASSIGNED) continue;
+				if (--in_degree[target] == 0) { labels[target] = state.next_label++; trimmed.push_back(target); }
+			}
+			for (size_t e = transposed.offsets()[current]; e < transposed.offsets()[current + 1]; ++e)
+			{
+				const uint32_t source = transposed.targets()[e];
+				if (labels[source] != UNASSIGNED) continue;
+				if (--out_degree[source] == 0) { labels[source] = state.next_label++; trimmed.push_back(source); }
+			}
+		}
+
+		std::vector<uint32_t> remaining;
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			if (labels[i] == UNASSIGNED) remaining.push_back(i);
+			else state.color[i].store(UNASSIGNED, std::memory_order_relaxed);
+		}
+		state.Solve(std::move(remaining), 0);
+		pool.Wait(state.group);
+		Components::Canonicalize(labels);
+		return labels;
+	}
+
+	std::vector<uint32_t> Components::WeaklyConnected(const CompactGraph& graph, ThreadPool& pool)
+	{
+		const size_t n = graph.size_nodes();
+		ConcurrentDisjointSet sets(n);
+		pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i)
+			{
+				for (size_t e = graph.offsets()[i]; e < graph.offsets()[i + 1]; ++e) { sets.Union((uint32_t)i, graph.targets()[e]); }
+			}
+		});
+		std::vector<uint32_t> labels(n);
+		pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) { labels[i] = sets.Find((uint32_t)i); }
+		});
+		Components::Canonicalize(labels);
+		return labels;
+	}
+
+	size_t Components::Count(const std::vector<uint32_t>& labels)
+	{
+		if (labels.empty()) return 0;
+		return (size_t)*std::max_element(labels.begin(), labels.end()) + 1;
+	}
+
+	Graph Components::Condensation(const CompactGraph& graph, const std::vector<uint32_t>& labels)
+	{
+		if (labels.size() != graph.size_nodes()) throw std::invalid_argument(Tools::string_format("Condensation: %zu labels given for graph with %zu nodes", labels.size(), graph.size_nodes()));
+		const size_t count = Components::Count(labels);
+		Graph output;
+		output.reserve_nodes(count);
+		for (uint32_t label = 0; label < count; ++label) { output.add(Node(label)); }
+		for (uint32_t i = 0; i < graph.size_nodes(); ++i)
+		{
+			for (size_t e = graph.offsets()[i]; e < graph.offsets()[i + 1]; ++e)
+			{
+				const uint32_t source = labels[i];
+				const uint32_t target = labels[graph.targets()[e]];
+				if (source == target) continue;
+				const Edge edge(Node(source), Node(target), graph.weights()[e]);
+				output.accumulate(edge, [](float stored, float incoming) { return std::min(stored, incoming); });
+			}
+		}
+		return output;
+	}
+}
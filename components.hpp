@@ -0,0 +1,96 @@
+#ifndef HWDG_COMPONENTS_HPP
+#define HWDG_COMPONENTS_HPP
+
+/**
+* @file components.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Connected components of graphs.
+*
+* This file contains Components class, which labels strongly and weakly connected components of CompactGraph and builds condensation of Graph.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class containing component analysis of graphs.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* Components are returned as array of labels indexed by CompactGraph::index(). Labels are dense (0..count-1) and canonical: 
+	* components are numbered in order of their lowest node index, so sequential and parallel algorithms return identical arrays.
+	*/
+	class Components
+	{
+		private:
+			static void Canonicalize(std::vector<uint32_t>& labels);
+		public:
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			Components() = delete;
+
+			/**
+			* Strongly connected components, computed with iterative Tarjan algorithm. Explicit stack is used instead of recursion, so deep graphs (long chains) are safe.
+			* \param graph Graph in CSR form.
+			* \return Label of component for every node, indexed by CompactGraph::index()
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static std::vector<uint32_t> StronglyConnected(const CompactGraph& graph);
+
+			/**
+			* Strongly connected components, computed in parallel with forward-backward algorithm.
+			*
+			* Nodes without incoming or outgoing edges are trimmed first, as they form single-node components. Then, for every remaining subset of nodes, 
+			* nodes reachable from pivot both forwards and backwards form component of pivot, while nodes reachable only forwards, only backwards or not at all form three independent subsets, processed in parallel.
+			* Result is identical to StronglyConnected().
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Label of component for every node, indexed by CompactGraph::index()
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$ expected per level of recursion, with independent subsets processed in parallel.
+			*/
+			static std::vector<uint32_t> ParallelStronglyConnected(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Weakly connected components (direction of edges is ignored), computed in parallel with lock-free union-find.
+			*
+			* Edges are processed in parallel, every one of them joins sets of its' endpoints. Roots are linked with compare-and-swap, always lower index becoming parent, and paths are halved during every search.
+			* Once labels are computed, "is B reachable from A, ignoring direction" is answered in constant time: labels[graph.index(a)] == labels[graph.index(b)]
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Label of component for every node, indexed by CompactGraph::index()
+			* \par Time complexity:
+			* \f$O(\frac{edges * \alpha(nodes)}{threads})\f$, where \f$\alpha\f$ is inverse Ackermann function.
+			*/
+			static std::vector<uint32_t> WeaklyConnected(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Get number of components.
+			* \param labels Labels returned by any function of this class.
+			* \par Time complexity:
+			* \f$O(nodes)\f$
+			*/
+			static size_t Count(const std::vector<uint32_t>& labels);
+
+			/**
+			* Build condensation of the graph: every component becomes single Node (with identifier equal to its' label), and edges between different components are merged into single Edge with the lowest weight.
+			* If labels are strongly connected components, condensation is directed acyclic graph.
+			* \param graph Graph in CSR form.
+			* \param labels Labels of components of the graph.
+			* \return Condensed Graph.
+			* \throws std::invalid_argument if number of labels is different from number of nodes.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static Graph Condensation(const CompactGraph& graph, const std::vector<uint32_t>& labels);
+	};
+}
+
+#endif
@@ -13,7 +13,11 @@
 * Operator -> for iterators is removed, because I couldn't make it work without terrible pointer hacking so it's safer this way.
 */
 
+#include <functional>
+#include <memory>
 #include <unordered_map>
+#include <utility>
+#include "arena_allocator.hpp"
 
 namespace HWDG
 {	
@@ -27,53 +31,95 @@ namespace HWDG
 		*/
 		namespace Map
 		{
+#ifdef HWDG_ARENA_ALLOCATOR
+			/**
+			* Allocator used by maps unless specified otherwise. Library is built with HWDG_ARENA_ALLOCATOR, so every map (including storage of Graph and NodeInGraph) keeps its' elements in its' own Arena.
+			* Definition changes layout of Graph, so it MUST be the same in library and every program using it. CMake option of the same name exports it to dependent targets.
+			*/
+			template<typename TYPE>
+			using DefaultAllocator = ArenaAllocator<TYPE>;
+#else
+			/**
+			* Allocator used by maps unless specified otherwise. Define HWDG_ARENA_ALLOCATOR (CMake option of the same name) to keep elements of every map in its' own Arena.
+			*/
+			template<typename TYPE>
+			using DefaultAllocator = std::allocator<TYPE>;
+#endif
+
+			/**
+			* std::unordered_map with given allocator, base of wrappers below.
+			*/
+			template<typename keytype, typename valuetype, typename allocator = DefaultAllocator<std::pair<const keytype, valuetype>>>
+			using base_map = std::unordered_map<keytype, valuetype, std::hash<keytype>, std::equal_to<keytype>, allocator>;
+
 			/**
 			* Thin wrapper for std::unordered_map::iterator
 			*/
-			template<typename keytype, typename valuetype>
-			class iterator : public std::unordered_map<keytype, valuetype>::iterator
+			template<typename keytype, typename valuetype, typename allocator = DefaultAllocator<std::pair<const keytype, valuetype>>>
+			class iterator : public base_map<keytype, valuetype, allocator>::iterator
 			{
 				public:
 					valuetype* operator -> () = delete;
 					valuetype& operator * ()
 					{
-						typename std::unordered_map<keytype, valuetype>::iterator& iter = *this;
+						typename base_map<keytype, valuetype, allocator>::iterator& iter = *this;
 						return iter->second;
 					}
-					iterator<keytype, valuetype>(const typename std::unordered_map<keytype, valuetype>::iterator& i) : std::unordered_map<keytype, valuetype>::iterator(i) {}
+					iterator(const typename base_map<keytype, valuetype, allocator>::iterator& i) : base_map<keytype, valuetype, allocator>::iterator(i) {}
 			};
 
 			/**
 			* Thin wrapper for std::unordered_map::const_iterator
 			*/
-			template<typename keytype, typename valuetype>
-			class const_iterator : public std::unordered_map<keytype, valuetype>::const_iterator
+			template<typename keytype, typename valuetype, typename allocator = DefaultAllocator<std::pair<const keytype, valuetype>>>
+			class const_iterator : public base_map<keytype, valuetype, allocator>::const_iterator
 			{
 				public:
 					const valuetype* operator -> () const = delete;
 					const valuetype& operator * () const
 					{
-						const typename std::unordered_map<keytype, valuetype>::const_iterator& iter = *this;
+						const typename base_map<keytype, valuetype, allocator>::const_iterator& iter = *this;
 						return iter->second;
 					}
-					const_iterator<keytype, valuetype>(const typename std::unordered_map<keytype, valuetype>::const_iterator& i) : std::unordered_map<keytype, valuetype>::const_iterator(i) {}
+					const_iterator(const typename base_map<keytype, valuetype, allocator>::const_iterator& i) : base_map<keytype, valuetype, allocator>::const_iterator(i) {}
 			};
 
 			/**
 			* Thin wrapper for std::unordered_map
 			*/
-			template<typename keytype, typename valuetype>
-			class unordered_map : public std::unordered_map<keytype, valuetype>
+			template<typename keytype, typename valuetype, typename allocator = DefaultAllocator<std::pair<const keytype, valuetype>>>
+			class unordered_map : public base_map<keytype, valuetype, allocator>
 			{
+				private:
+					using base = base_map<keytype, valuetype, allocator>;
+					using iterator_type = iterator<keytype, valuetype, allocator>;
+					using const_iterator_type = const_iterator<keytype, valuetype, allocator>;
 				public:
-					iterator<keytype, valuetype> begin() { return iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::begin()); }
-					const_iterator<keytype, valuetype> cbegin() const { return const_iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::cbegin()); }
-					const_iterator<keytype, valuetype> begin() const { return const_iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::begin()); }
-					iterator<keytype, valuetype> end() { return (iterator<keytype, valuetype>) std::unordered_map<keytype, valuetype>::end(); }
-					const_iterator<keytype, valuetype> cend() const { return const_iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::cend()); }
-					const_iterator<keytype, valuetype> end() const { return const_iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::end()); }
-					iterator<keytype, valuetype> find(const keytype& id) { return iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::find(id)); }
-					const_iterator<keytype, valuetype> find(const keytype& id) const { return const_iterator<keytype, valuetype>(std::unordered_map<keytype, valuetype>::find(id)); }
+					iterator_type begin() { return iterator_type(base::begin()); }
+					const_iterator_type cbegin() const { return const_iterator_type(base::cbegin()); }
+					const_iterator_type begin() const { return const_iterator_type(base::begin()); }
+					iterator_type end() { return iterator_type(base::end()); }
+					const_iterator_type cend() const { return const_iterator_type(base::cend()); }
+					const_iterator_type end() const { return const_iterator_type(base::end()); }
+					iterator_type find(const keytype& id) { return iterator_type(base::find(id)); }
+					const_iterator_type find(const keytype& id) const { return const_iterator_type(base::find(id)); }
+
+					/**
+					* Release memory left by erased elements. Buckets are fitted to content, and if allocator keeps state (like ArenaAllocator), elements are moved to new storage, so the old one can be released.
+					* \par Time complexity:
+					* \f$O(size)\f$
+					*/
+					void shrink(void)
+					{
+						if constexpr (std::allocator_traits<allocator>::is_always_equal::value) { base::rehash(0); }
+						else
+						{
+							unordered_map fitted;
+							fitted.reserve(base::size());
+							for (auto& pair : static_cast<base&>(*this)) { fitted.emplace(pair.first, std::move(pair.second)); }
+							base::swap(fitted);
+						}
+					}
 			};
 		}
 	//#endif
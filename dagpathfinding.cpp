@@ -0,0 +1,80 @@
+
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "dagpathfinding.hpp"
+#include "node_in_graph.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	bool DAGPathfinding::Order(const Graph& graph, std::vector<Node>& output)
+	{
+		output.clear();
+		output.reserve(graph.size_nodes());
+		std::unordered_map<uint32_t, uint32_t> in_degree;
+		in_degree.reserve(graph.size_nodes());
+		for (const Edge& edge : graph.edges()) { in_degree[edge.target().id()]++; }
+		for (const NodeInGraph& node : graph)
+		{
+			if (in_degree.find(node.id()) == in_degree.end()) output.push_back(node);
+		}
+		// Output doubles as FIFO queue
+		for (size_t next = 0; next < output.size(); ++next)
+		{
+			for (const Edge& edge : graph.fetch(output[next]))
+			{
+				if (--in_degree[edge.target().id()] == 0) output.push_back(edge.target());
+			}
+		}
+		// Nodes on cycles never reach in-degree of 0
+		return output.size() == graph.size_nodes();
+	}
+
+	Pathtable<PathtableCell> DAGPathfinding::Relax(const Graph& graph, const Node& src, const std::vector<Node>& order, bool longest)
+	{
+		Pathtable<PathtableCell> output(graph, src);
+		bool reached = false;
+		for (const Node& node : order)
+		{
+			// Nodes before source can't be reached
+			if (node == src) reached = true;
+			if (!reached) continue;
+			const PathtableCell& current = output.getCell(node);
+			if (current.prev_id == PathtableCell::NO_PREVIOUS) continue;
+			for (const Edge& edge : graph.fetch(node))
+			{
+				const double pathweight = current.pathweight + edge.weight();
+				const PathtableCell& target = output.getCell(edge.target());
+				const bool better = longest ? (pathweight > target.pathweight) : (pathweight < target.pathweight);
+				if (target.prev_id == PathtableCell::NO_PREVIOUS || better) output.UpdateWeight(edge.target(), node, pathweight);
+			}
+		}
+		return output;
+	}
+
+	std::vector<Node> DAGPathfinding::TopologicalSort(const Graph& graph)
+	{
+		std::vector<Node> output;
+		if (!DAGPathfinding::Order(graph, output)) throw std::invalid_argument("TopologicalSort: graph contains cycle");
+		return output;
+	}
+
+	bool DAGPathfinding::IsAcyclic(const Graph& graph)
+	{
+		std::vector<Node> order;
+		return DAGPathfinding::Order(graph, order);
+	}
+
+	Pathtable<PathtableCell> DAGPathfinding::ShortestPaths(const Graph& graph, const Node& src)
+	{
+		if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+		return DAGPathfinding::Relax(graph, src, DAGPathfinding::TopologicalSort(graph), false);
+	}
+
+	Pathtable<PathtableCell> DAGPathfinding::LongestPaths(const Graph& graph, const Node& src)
+	{
+		if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+		return DAGPathfinding::Relax(graph, src, DAGPathfinding::TopologicalSort(graph), true);
+	}
+}
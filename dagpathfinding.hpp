@@ -0,0 +1,81 @@
+#ifndef HWDG_DAGPATHFINDING_HPP
+#define HWDG_DAGPATHFINDING_HPP
+
+/**
+* @file dagpathfinding.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Topological sort and pathfinding in directed acyclic graphs.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+#include "path.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class implementing topological sort and linear-time pathfinding in directed acyclic graphs (DAG).
+	*
+	* In DAG, nodes can be ordered so that every Edge points forward. Relaxing edges of nodes in that order finds shortest (or longest) paths in single pass,
+	* even if weights are negative. BellmanFord::Compute() uses this class automatically when Graph turns out to be acyclic.
+	*/
+	class DAGPathfinding
+	{
+		friend class BellmanFord;
+		private:
+			static bool Order(const Graph& graph, std::vector<Node>& output);
+			static Pathtable<PathtableCell> Relax(const Graph& graph, const Node& src, const std::vector<Node>& order, bool longest);
+		public:
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			DAGPathfinding() = delete;
+
+			/**
+			* Topological sort (Kahn algorithm): order of nodes in which every Edge leads from earlier Node to later one.
+			* \param graph Directed acyclic graph.
+			* \return All nodes of the graph, in topological order.
+			* \throws std::invalid_argument if Graph contains cycle (including loop).
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static std::vector<Node> TopologicalSort(const Graph& graph);
+
+			/**
+			* Check whether Graph is acyclic.
+			* \param graph Graph to be checked.
+			* \return true if there's no cycle (including loops) within graph.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static bool IsAcyclic(const Graph& graph);
+
+			/**
+			* Shortest paths from source Node to every other Node. Negative weights are allowed.
+			* \param graph Directed acyclic graph.
+			* \param src Source Node, for which the Pathtable will be created.
+			* \return Pathtable with paths from source Node to every other Node within Graph.
+			* \throws std::invalid_argument if src doesn't belong to Graph, or Graph contains cycle.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static Pathtable<PathtableCell> ShortestPaths(const Graph& graph, const Node& src);
+
+			/**
+			* Longest paths from source Node to every other Node (for example, critical path of task dependencies). Negative weights are allowed.
+			* \param graph Directed acyclic graph.
+			* \param src Source Node, for which the Pathtable will be created.
+			* \return Pathtable with paths from source Node to every other Node within Graph.
+			* \throws std::invalid_argument if src doesn't belong to Graph, or Graph contains cycle.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			static Pathtable<PathtableCell> LongestPaths(const Graph& graph, const Node& src);
+	};
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include <limits>
 #include <vector>
 #include <algorithm>
+#include <queue>
+#include <unordered_map>
 #include "dijkstra.hpp"
 #include "custom_map.hpp"
 #include "tools.hpp"
@@ -126,4 +128,90 @@ namespace HWDG
 		Dijkstra vessel(graph, src);
 		return vessel.Results();
 	}
+
+	void Dijkstra::Local(const Graph& graph, const Node& src, const double& radius, const size_t& count, const int64_t& target, Workspace& workspace, std::vector<PathtableCell>* output)
+	{
+		// Condition check
+		if (!graph.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given graph", src.str().c_str()));
+		if (graph.has_negative_weights()) throw std::invalid_argument("Dijkstra algorithm cannot be used for graphs with negative weights of edges.");
+		// Initialisation - only nodes that were reached get a cell, so nothing here depends on size of graph
+		workspace.Clear();
+		auto& cells = workspace._cells;
+		auto& queue = workspace._queue;
+		const auto compare = std::greater<std::pair<double, uint32_t>>();
+		cells.insert({ src.id(), PathtableCell(src, src) });
+		queue.push_back({ 0, src.id() });
+		size_t settled = 0;
+
+		// Dijkstra Algorithm with lazy deletion: outdated entries on heap are skipped when popped
+		while (queue.size() && settled < count)
+		{
+			std::pop_heap(queue.begin(), queue.end(), compare);
+			const double pathweight = queue.back().first;
+			const uint32_t id = queue.back().second;
+			queue.pop_back();
+			if (pathweight > radius) break;
+			const PathtableCell& current_cell = cells.at(id);
+			if (pathweight > current_cell.pathweight) continue;
+			settled++;
+			if (output) output->push_back(current_cell);
+			if (id == target) break;
+
+			for (const Edge& edge : graph.fetch(Node(id)))
+			{
+				double pathweight_from_current = pathweight + edge.weight();
+				auto iter = cells.find(edge.target().id());
+				if (iter == cells.end())
+				{
+					cells.insert({ edge.target().id(), PathtableCell(edge.target(), pathweight_from_current, id) });
+				}
+				else if (iter->second.pathweight > pathweight_from_current)
+				{
+					iter->second.pathweight = pathweight_from_current;
+					iter->second.prev_id = id;
+				}
+				else continue;
+				queue.push_back({ pathweight_from_current, edge.target().id() });
+				std::push_heap(queue.begin(), queue.end(), compare);
+			}
+		}
+	}
+
+	std::vector<PathtableCell> Dijkstra::ComputeWithinRadius(const Graph& graph, const Node& src, const double& radius, Workspace& workspace)
+	{
+		std::vector<PathtableCell> output;
+		Dijkstra::Local(graph, src, radius, std::numeric_limits<size_t>::max(), PathtableCell::NO_PREVIOUS, workspace, &output);
+		return output;
+	}
+
+	std::vector<PathtableCell> Dijkstra::ComputeWithinRadius(const Graph& graph, const Node& src, const double& radius)
+	{
+		Workspace workspace;
+		return Dijkstra::ComputeWithinRadius(graph, src, radius, workspace);
+	}
+
+	std::vector<PathtableCell> Dijkstra::ComputeNearest(const Graph& graph, const Node& src, const size_t& count, Workspace& workspace)
+	{
+		std::vector<PathtableCell> output;
+		Dijkstra::Local(graph, src, std::numeric_limits<double>::max(), count, PathtableCell::NO_PREVIOUS, workspace, &output);
+		return output;
+	}
+
+	std::vector<PathtableCell> Dijkstra::ComputeNearest(const Graph& graph, const Node& src, const size_t& count)
+	{
+		Workspace workspace;
+		return Dijkstra::ComputeNearest(graph, src, count, workspace);
+	}
+
+	Path Dijkstra::ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace)
+	{
+		Dijkstra::Local(graph, src, std::numeric_limits<double>::max(), std::numeric_limits<size_t>::max(), tgt.id(), workspace, nullptr);
+		return workspace.GetPath(tgt);
+	}
+
+	Path Dijkstra::ComputePath(const Graph& graph, const Node& src, const Node& tgt)
+	{
+		Workspace workspace;
+		return Dijkstra::ComputePath(graph, src, tgt, workspace);
+	}
 }
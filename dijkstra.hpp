@@ -10,6 +10,7 @@
 * This file contains class Dijkstra, which is written in horrible yet consistent way with BellmanFord.
 */
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include "node.hpp"
@@ -21,9 +22,6 @@
 
 namespace HWDG
 {
-#include <vector>
-#include <algorithm>
-
 	/**
 	* Static class implementing Dijkstra algorithm for pathfinding.
 	* Because it's static class, you can't create objects of it. You are supposed only to call Dijkstra::Compute() static function.
@@ -57,6 +55,7 @@ namespace HWDG
 			const Cell& getCell(const Node& node) const;
 			void UpdateWeight(const Node& node, const Node& prev_node, const double& pathweight);
 			void Algorithm(const Graph& graph);
+			static void Local(const Graph& graph, const Node& src, const double& radius, const size_t& count, const int64_t& target, Workspace& workspace, std::vector<PathtableCell>* output);
 		private:
 			Dijkstra(const Graph& graph, const Node& src);
 			Path GetPath(const Node& target) const;
@@ -77,6 +76,74 @@ namespace HWDG
 			* \f$O(nodes * \log_{2}nodes)\f$
 			*/
 			static Pathtable<Dijkstra::Cell> Compute(const Graph& graph, const Node& src);
+
+			/**
+			* Execute Dijkstra algorithm bounded by radius.
+			* It calculates shortest path from source Node to every Node whose distance from source is not greater than radius, and stops as soon as the closest unsettled Node lies further away.
+			*
+			* Contrary to Dijkstra::Compute(), it doesn't create Pathtable covering whole Graph, so cost of the query depends only on the explored neighbourhood.
+			*
+			* \param graph Graph that you want to search.
+			* \param src Source Node.
+			* \param radius Maximal distance (sum of weights) from source Node.
+			* \return List of cells (Node, distance, PathtableCell::prev_id) sorted by distance, starting with source Node.
+			* \throws std::invalid_argument if Graph has negative weights, or source Node doesn't belong to Graph.
+			*
+			* \par Time complexity:
+			* \f$O(edges_{R} * \log_{2}edges_{R})\f$, where \f$edges_{R}\f$ is number of edges coming out from nodes within radius.
+			*/
+			static std::vector<PathtableCell> ComputeWithinRadius(const Graph& graph, const Node& src, const double& radius);
+
+			/**
+			* Execute Dijkstra algorithm bounded by radius, reusing memory of given Workspace.
+			* Check Dijkstra::ComputeWithinRadius(const Graph&, const Node&, const double&)
+			*/
+			static std::vector<PathtableCell> ComputeWithinRadius(const Graph& graph, const Node& src, const double& radius, Workspace& workspace);
+
+			/**
+			* Execute Dijkstra algorithm for k nearest nodes.
+			* It calculates shortest path from source Node to count closest nodes, and stops right after count-th Node is settled. Source Node is included in the count.
+			*
+			* Contrary to Dijkstra::Compute(), it doesn't create Pathtable covering whole Graph, so cost of the query depends only on the explored neighbourhood.
+			*
+			* \param graph Graph that you want to search.
+			* \param src Source Node.
+			* \param count Number of nodes to be settled. Less nodes are returned if there aren't enough accessible from source.
+			* \return List of cells (Node, distance, PathtableCell::prev_id) sorted by distance, starting with source Node.
+			* \throws std::invalid_argument if Graph has negative weights, or source Node doesn't belong to Graph.
+			*
+			* \par Time complexity:
+			* \f$O(edges_{k} * \log_{2}edges_{k})\f$, where \f$edges_{k}\f$ is number of edges coming out from k nearest nodes.
+			*/
+			static std::vector<PathtableCell> ComputeNearest(const Graph& graph, const Node& src, const size_t& count);
+
+			/**
+			* Execute Dijkstra algorithm for k nearest nodes, reusing memory of given Workspace.
+			* Check Dijkstra::ComputeNearest(const Graph&, const Node&, const size_t&)
+			*/
+			static std::vector<PathtableCell> ComputeNearest(const Graph& graph, const Node& src, const size_t& count, Workspace& workspace);
+
+			/**
+			* Execute Dijkstra algorithm for single pair of nodes.
+			* It stops as soon as target Node is settled, so only part of Graph closer to source than target is explored.
+			*
+			* \param graph Graph that you want to search.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \param workspace Workspace to be used (and reused by next queries). After the call, it holds cells of all nodes reached by the search.
+			* \return Shortest Path from source to target Node.
+			* \throws std::invalid_argument if Graph has negative weights, or source Node doesn't belong to Graph.
+			*
+			* \par Time complexity:
+			* \f$O(nodes * \log_{2}nodes)\f$ in the worst case.
+			*/
+			static Path ComputePath(const Graph& graph, const Node& src, const Node& tgt, Workspace& workspace);
+
+			/**
+			* Execute Dijkstra algorithm for single pair of nodes.
+			* Check Dijkstra::ComputePath(const Graph&, const Node&, const Node&, Workspace&)
+			*/
+			static Path ComputePath(const Graph& graph, const Node& src, const Node& tgt);
 			Dijkstra() = delete;
 	};
 }
@@ -0,0 +1,335 @@
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "flow.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+	}
+
+	FlowNetwork::FlowNetwork(const CompactGraph& graph) : _graph(graph), _source(NONE), _value(0)
+	{
+		const size_t n = graph.size_nodes();
+		const std::vector<size_t>& offsets = graph.offsets();
+		const std::vector<uint32_t>& targets = graph.targets();
+		const std::vector<float>& weights = graph.weights();
+
+		this->_offsets.assign(n + 1, 0);
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = offsets[i]; e < offsets[i + 1]; ++e)
+			{
+				if (weights[e] < 0) throw std::invalid_argument(Tools::string_format("FlowNetwork: edge %u->%u has negative capacity %f", graph.ids()[i], graph.ids()[targets[e]], weights[e]));
+				if (targets[e] == i) continue;
+				this->_offsets[i + 1]++;
+				this->_offsets[targets[e] + 1]++;
+			}
+		}
+		for (size_t i = 0; i < n; ++i) { this->_offsets[i + 1] += this->_offsets[i]; }
+
+		const size_t arcs = this->_offsets[n];
+		this->_targets.resize(arcs);
+		this->_residual.assign(arcs, 0);
+		this->_reverse.resize(arcs);
+		this->_arcs.assign(graph.size_edges(), NO_ARC);
+		std::vector<size_t> position(this->_offsets.begin(), this->_offsets.end() - 1);
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			for (size_t e = offsets[i]; e < offsets[i + 1]; ++e)
+			{
+				const uint32_t target = targets[e];
+				if (target == i) continue;
+				const size_t forward = position[i]++;
+				const size_t backward = position[target]++;
+				this->_targets[forward] = target;
+				this->_targets[backward] = i;
+				this->_reverse[forward] = backward;
+				this->_reverse[backward] = forward;
+				this->_residual[forward] = weights[e];
+				this->_arcs[e] = forward;
+			}
+		}
+	}
+
+	void FlowNetwork::Reset(const Node& source, const Node& sink, uint32_t& s, uint32_t& t)
+	{
+		s = this->_graph.index(source);
+		t = this->_graph.index(sink);
+		if (s == t) throw std::invalid_argument(Tools::string_format("FlowNetwork: source and sink are the same node %u", source.id()));
+		std::fill(this->_residual.begin(), this->_residual.end(), 0);
+		for (size_t e = 0; e < this->_arcs.size(); ++e)
+		{
+			if (this->_arcs[e] != NO_ARC) this->_residual[this->_arcs[e]] = this->_graph.weights()[e];
+		}
+		this->_source = s;
+		this->_value = 0;
+	}
+
+	void FlowNetwork::GlobalRelabel(const uint32_t& source, const uint32_t& sink, std::vector<uint32_t>& height) const
+	{
+		// Exact distances to sink in residual network, then (for nodes that can't reach sink) distances to source shifted by number of nodes
+		const uint32_t n = static_cast<uint32_t>(height.size());
+		std::fill(height.begin(), height.end(), 2 * n);
+		std::vector<uint32_t> queue;
+		queue.reserve(n);
+		const uint32_t roots[2] = { sink, source };
+		const uint32_t bases[2] = { 0, n };
+		for (size_t pass = 0; pass < 2; ++pass)
+		{
+			if (height[roots[pass]] != 2 * n) continue;
+			queue.clear();
+			queue.push_back(roots[pass]);
+			height[roots[pass]] = bases[pass];
+			for (size_t head = 0; head < queue.size(); ++head)
+			{
+				const uint32_t node = queue[head];
+				for (size_t a = this->_offsets[node]; a < this->_offsets[node + 1]; ++a)
+				{
+					const uint32_t previous = this->_targets[a];
+					if (height[previous] != 2 * n || this->_residual[this->_reverse[a]] <= 0) continue;
+					if (pass == 0 && previous == source) continue;
+					height[previous] = height[node] + 1;
+					queue.push_back(previous);
+				}
+			}
+		}
+		height[source] = n;
+	}
+
+	double FlowNetwork::PushRelabel(const Node& source, const Node& sink)
+	{
+		uint32_t s, t;
+		this->Reset(source, sink, s, t);
+		const uint32_t n = static_cast<uint32_t>(this->_graph.size_nodes());
+		const size_t limit = 2 * static_cast<size_t>(n);
+		std::vector<double> excess(n, 0);
+		std::vector<uint32_t> height(n);
+		std::vector<size_t> current(this->_offsets.begin(), this->_offsets.end() - 1);
+		std::vector<std::vector<uint32_t>> active(limit + 1);
+		size_t highest = 0;
+
+		for (size_t a = this->_offsets[s]; a < this->_offsets[s + 1]; ++a)
+		{
+			const double delta = this->_residual[a];
+			if (delta <= 0) continue;
+			this->_residual[a] = 0;
+			this->_residual[this->_reverse[a]] += delta;
+			excess[this->_targets[a]] += delta;
+			excess[s] -= delta;
+		}
+
+		auto relabel_all = [&]() {
+			this->GlobalRelabel(s, t, height);
+			for (std::vector<uint32_t>& bucket : active) { bucket.clear(); }
+			highest = 0;
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				current[i] = this->_offsets[i];
+				if (i == s || i == t || excess[i] <= 0 || height[i] >= limit) continue;
+				active[height[i]].push_back(i);
+				highest = std::max<size_t>(highest, height[i]);
+			}
+		};
+		relabel_all();
+
+		const size_t threshold = 6 * static_cast<size_t>(n) + this->_targets.size();
+		size_t work = 0;
+		while (true)
+		{
+			while (highest > 0 && active[highest].empty()) { highest--; }
+			if (active[highest].empty()) break;
+			const uint32_t node = active[highest].back();
+			active[highest].pop_back();
+
+			// Discharge
+			while (excess[node] > 0)
+			{
+				if (current[node] == this->_offsets[node + 1])
+				{
+					uint32_t lowest = static_cast<uint32_t>(limit);
+					for (size_t a = this->_offsets[node]; a < this->_offsets[node + 1]; ++a)
+					{
+						if (this->_residual[a] > 0) lowest = std::min(lowest, height[this->_targets[a]]);
+					}
+					height[node] = lowest + 1;
+					current[node] = this->_offsets[node];
+					work += this->_offsets[node + 1] - this->_offsets[node] + 12;
+					if (height[node] >= limit) break;
+					continue;
+				}
+				const size_t a = current[node];
+				const uint32_t target = this->_targets[a];
+				if (this->_residual[a] > 0 && height[node] == height[target] + 1)
+				{
+					const double delta = std::min(excess[node], this->_residual[a]);
+					if (excess[target] <= 0 && target != s && target != t)
+					{
+						active[height[target]].push_back(target);
+						highest = std::max<size_t>(highest, height[target]);
+					}
+					this->_residual[a] -= delta;
+					this->_residual[this->_reverse[a]] += delta;
+					excess[node] -= delta;
+					excess[target] += delta;
+					if (this->_residual[a] <= 0) current[node]++;
+				}
+				else current[node]++;
+			}
+
+			if (work > threshold)
+			{
+				work = 0;
+				relabel_all();
+			}
+		}
+		this->_value = excess[t];
+		return this->_value;
+	}
+
+	double FlowNetwork::Dinic(const Node& source, const Node& sink)
+	{
+		uint32_t s, t;
+		this->Reset(source, sink, s, t);
+		const size_t n = this->_graph.size_nodes();
+		std::vector<uint32_t> level(n);
+		std::vector<uint32_t> queue;
+		queue.reserve(n);
+		std::vector<size_t> current(n);
+		std::vector<size_t> path;
+		double total = 0;
+		while (true)
+		{
+			// Levels of nodes in residual network
+			std::fill(level.begin(), level.end(), NONE);
+			level[s] = 0;
+			queue.clear();
+			queue.push_back(s);
+			for (size_t head = 0; head < queue.size() && level[t] == NONE; ++head)
+			{
+				const uint32_t node = queue[head];
+				for (size_t a = this->_offsets[node]; a < this->_offsets[node + 1]; ++a)
+				{
+					const uint32_t target = this->_targets[a];
+					if (level[target] != NONE || this->_residual[a] <= 0) continue;
+					level[target] = level[node] + 1;
+					queue.push_back(target);
+				}
+			}
+			if (level[t] == NONE) break;
+
+			// Blocking flow, found by iterative depth-first search with current-arc pointers
+			std::copy(this->_offsets.begin(), this->_offsets.end() - 1, current.begin());
+			path.clear();
+			uint32_t node = s;
+			while (true)
+			{
+				if (node == t)
+				{
+					double bottleneck = std::numeric_limits<double>::max();
+					for (const size_t& a : path) { bottleneck = std::min(bottleneck, this->_residual[a]); }
+					size_t saturated = path.size();
+					for (size_t i = 0; i < path.size(); ++i)
+					{
+						this->_residual[path[i]] -= bottleneck;
+						this->_residual[this->_reverse[path[i]]] += bottleneck;
+						if (saturated == path.size() && this->_residual[path[i]] <= 0) saturated = i;
+					}
+					total += bottleneck;
+					path.resize(saturated);
+					node = path.empty() ? s : this->_targets[path.back()];
+					continue;
+				}
+				bool advanced = false;
+				for (; current[node] < this->_offsets[node + 1]; ++current[node])
+				{
+					const size_t a = current[node];
+					const uint32_t target = this->_targets[a];
+					if (this->_residual[a] > 0 && level[target] == level[node] + 1)
+					{
+						path.push_back(a);
+						node = target;
+						advanced = true;
+						break;
+					}
+				}
+				if (advanced) continue;
+				// Dead end, nothing can pass through this node anymore
+				level[node] = NONE;
+				if (node == s) break;
+				const size_t a = path.back();
+				path.pop_back();
+				node = this->_targets[this->_reverse[a]];
+				current[node]++;
+			}
+		}
+		this->_value = total;
+		return this->_value;
+	}
+
+	double FlowNetwork::value(void) const
+	{
+		return this->_value;
+	}
+
+	double FlowNetwork::flow(const Edge& edge) const
+	{
+		const uint32_t source = this->_graph.index(edge.source());
+		const uint32_t target = this->_graph.index(edge.target());
+		const std::vector<uint32_t>& targets = this->_graph.targets();
+		const auto first = targets.begin() + this->_graph.offsets()[source];
+		const auto last = targets.begin() + this->_graph.offsets()[source + 1];
+		const auto it = std::lower_bound(first, last, target);
+		if (it == last || *it != target) throw std::out_of_range(Tools::string_format("FlowNetwork: edge %u->%u doesn't belong to the graph", edge.source().id(), edge.target().id()));
+		const size_t arc = this->_arcs[it - targets.begin()];
+		if (arc == NO_ARC) return 0;
+		return this->_graph.weights()[it - targets.begin()] - this->_residual[arc];
+	}
+
+	std::vector<Node> FlowNetwork::SourceSide(void) const
+	{
+		std::vector<Node> output;
+		if (this->_source == NONE) return output;
+		std::vector<bool> visited(this->_graph.size_nodes(), false);
+		std::vector<uint32_t> queue(1, this->_source);
+		visited[this->_source] = true;
+		for (size_t head = 0; head < queue.size(); ++head)
+		{
+			const uint32_t node = queue[head];
+			for (size_t a = this->_offsets[node]; a < this->_offsets[node + 1]; ++a)
+			{
+				const uint32_t target = this->_targets[a];
+				if (visited[target] || this->_residual[a] <= 0) continue;
+				visited[target] = true;
+				queue.push_back(target);
+			}
+		}
+		std::sort(queue.begin(), queue.end());
+		output.reserve(queue.size());
+		for (const uint32_t& node : queue) { output.push_back(this->_graph.node(node)); }
+		return output;
+	}
+
+	std::vector<Edge> FlowNetwork::MinimumCut(void) const
+	{
+		std::vector<Edge> output;
+		const std::vector<Node> side = this->SourceSide();
+		std::vector<bool> inside(this->_graph.size_nodes(), false);
+		for (const Node& node : side) { inside[this->_graph.index(node)] = true; }
+		for (const Node& node : side)
+		{
+			const uint32_t i = this->_graph.index(node);
+			for (size_t e = this->_graph.offsets()[i]; e < this->_graph.offsets()[i + 1]; ++e)
+			{
+				const uint32_t target = this->_graph.targets()[e];
+				if (!inside[target]) output.push_back(Edge(node, this->_graph.node(target), this->_graph.weights()[e]));
+			}
+		}
+		return output;
+	}
+}
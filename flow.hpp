@@ -0,0 +1,110 @@
+#ifndef HWDG_FLOW_HPP
+#define HWDG_FLOW_HPP
+
+/**
+* @file flow.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Maximum flow and minimum cut.
+*
+* This file contains FlowNetwork class, residual network built from CompactGraph, computing maximum flow between two nodes.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "compact_graph.hpp"
+
+namespace HWDG
+{
+	/**
+	* Residual network of the graph, with weights of edges used as capacities.
+	*
+	* Every edge is stored as pair of arcs - forward one with residual capacity equal to weight of the edge, and backward one with residual capacity equal to current flow.
+	* Network keeps flow computed by the last query, so flow(), SourceSide() and MinimumCut() describe it until next query is run. Loops are ignored.
+	*/
+	class FlowNetwork
+	{
+		private:
+			CompactGraph _graph;
+			std::vector<size_t> _offsets;
+			std::vector<uint32_t> _targets;
+			std::vector<double> _residual;
+			std::vector<size_t> _reverse;
+			// Forward arc of every edge of _graph, NO_ARC for loops
+			std::vector<size_t> _arcs;
+			uint32_t _source;
+			double _value;
+		private:
+			static constexpr size_t NO_ARC = static_cast<size_t>(-1);
+			void Reset(const Node& source, const Node& sink, uint32_t& s, uint32_t& t);
+			void GlobalRelabel(const uint32_t& source, const uint32_t& sink, std::vector<uint32_t>& height) const;
+		public:
+			/**
+			* Build residual network of the graph.
+			* \param graph Graph in CSR form, weights of edges are capacities.
+			* \throws std::invalid_argument if graph has negative weights.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			FlowNetwork(const CompactGraph& graph);
+
+			/**
+			* Compute maximum flow using highest-label push-relabel algorithm with global relabeling.
+			* \param source Node the flow comes out of.
+			* \param sink Node the flow goes into.
+			* \return Value of maximum flow.
+			* \throws std::out_of_range if source or sink doesn't belong to the graph.
+			* \throws std::invalid_argument if source and sink are the same Node.
+			* \par Time complexity:
+			* \f$O(nodes^2 * \sqrt{edges})\f$
+			*/
+			double PushRelabel(const Node& source, const Node& sink);
+
+			/**
+			* Compute maximum flow using Dinic's algorithm (blocking flows along shortest augmenting paths). Alternative to PushRelabel(), with better worst-case bound on unit capacity networks.
+			* \param source Node the flow comes out of.
+			* \param sink Node the flow goes into.
+			* \return Value of maximum flow.
+			* \throws std::out_of_range if source or sink doesn't belong to the graph.
+			* \throws std::invalid_argument if source and sink are the same Node.
+			* \par Time complexity:
+			* \f$O(nodes^2 * edges)\f$ in general, \f$O(edges * \sqrt{edges})\f$ for unit capacities.
+			*/
+			double Dinic(const Node& source, const Node& sink);
+
+			/**
+			* \return Value of flow computed by the last query, 0 if no query was run.
+			*/
+			double value(void) const;
+
+			/**
+			* Get flow going through the edge.
+			* \param edge Edge of the graph, weight is ignored.
+			* \return Flow going through the edge, 0 for loops.
+			* \throws std::out_of_range if edge doesn't belong to the graph.
+			* \par Time complexity:
+			* \f$O(log(degree))\f$
+			*/
+			double flow(const Edge& edge) const;
+
+			/**
+			* Get source side of minimum cut - nodes reachable from source in residual network.
+			* \return Nodes of source side, in ascending order of identifiers. Empty if no query was run.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			std::vector<Node> SourceSide(void) const;
+
+			/**
+			* Get minimum cut - edges coming from source side to the rest of the graph. Sum of their weights is equal to value().
+			* \return Edges of minimum cut, with weights equal to their capacities. Empty if no query was run.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			std::vector<Edge> MinimumCut(void) const;
+	};
+}
+
+#endif
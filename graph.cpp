@@ -1,10 +1,31 @@
 
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "tools.hpp"
 #include "graph.hpp"
 
 namespace HWDG
 {
+	namespace
+	{
+		// Distinct salts for nodes and edges. Identifiers of edges cover almost every 64-bit value, so node identifier is also mixed once more:
+		// otherwise some Edge would hash exactly like some Node, and XOR of both would cancel out.
+		constexpr uint64_t NODE_SALT = 0x243F6A8885A308D3ull;
+		constexpr uint64_t EDGE_SALT = 0x13198A2E03707344ull;
+	}
+
+	// Contributions of nodes and edges are combined with XOR, so that order of additions doesn't matter
+	uint64_t Graph::Fingerprint(const Node& node)
+	{
+		return Tools::Mix64(Tools::Mix64((uint64_t)node.id() ^ NODE_SALT));
+	}
+
+	uint64_t Graph::Fingerprint(const Edge& edge)
+	{
+		return Tools::Mix64(edge.id() ^ EDGE_SALT);
+	}
 
 	size_t Graph::size_edges(void) const
 	{
@@ -75,6 +96,7 @@ namespace HWDG
 		if (this->has(node)) return false;
 		NodeInGraph n = node;
 		this->_nodes.insert({ node.id(), n });
+		this->_fingerprint = this->_fingerprint ^ Graph::Fingerprint(node);
 		return true;
 	}
 
@@ -85,6 +107,7 @@ namespace HWDG
 		if (edge.source() == edge.target()) { this->_loops++; }
 		this->_edges.insert({ edge.id(), edge });
 		this->_weight_sum = this->_weight_sum + edge.weight();
+		this->_fingerprint = this->_fingerprint ^ Graph::Fingerprint(edge);
 		const Node& src = edge.source();
 		if (!this->has(src)) this->add(src);
 		auto iter = this->_nodes.find(src.id());
@@ -95,24 +118,146 @@ namespace HWDG
 
 	void Graph::update(const Edge& edge)
 	{
-		this->remove(edge);
-		this->add(edge);
+		if (!this->update_weight(edge)) this->add(edge);
+	}
+
+	void Graph::replace_weight(Edge& stored, const float& weight)
+	{
+		if (stored.weight() < 0) { this->_negative_edges--; }
+		if (weight < 0) { this->_negative_edges++; }
+		this->_weight_sum = this->_weight_sum - stored.weight() + weight;
+		stored = Edge(stored.source(), stored.target(), weight);
+		auto iter = this->_nodes.find(stored.source().id());
+		(*iter).update_weight(stored);
+	}
+
+	bool Graph::update_weight(const Edge& edge)
+	{
+		auto iter = this->_edges.find(edge.id());
+		if (iter == this->_edges.end()) return false;
+		this->replace_weight(*iter, edge.weight());
+		return true;
+	}
+
+	void Graph::accumulate(const Edge& edge)
+	{
+		auto iter = this->_edges.find(edge.id());
+		if (iter == this->_edges.end()) { this->add(edge); return; }
+		this->replace_weight(*iter, (*iter).weight() + edge.weight());
+	}
+
+	void Graph::accumulate(const Edge& edge, const std::function<float(float stored, float incoming)>& combine)
+	{
+		auto iter = this->_edges.find(edge.id());
+		if (iter == this->_edges.end()) { this->add(edge); return; }
+		this->replace_weight(*iter, combine((*iter).weight(), edge.weight()));
 	}
 
 
+	void Graph::forget(const Edge& stored)
+	{
+		if (stored.weight() < 0) { this->_negative_edges--; }
+		if (stored.source() == stored.target()) { this->_loops--; }
+		this->_weight_sum = this->_weight_sum - stored.weight();
+		this->_fingerprint = this->_fingerprint ^ Graph::Fingerprint(stored);
+	}
+
 	bool Graph::remove(const Edge& edge)
 	{
 		if (!this->has(edge)) return false;
-		if (this->fetch(edge).weight() < 0) { this->_negative_edges--; }
-		if (edge.source() == edge.target()) { this->_loops--; }
-		this->_weight_sum = this->_weight_sum - this->fetch(edge).weight();
+		this->forget(this->fetch(edge));
 		this->_edges.erase(edge.id());
 		const Node& src = edge.source();
 		auto iter = this->_nodes.find(src.id());
 		(*iter).remove(edge);
+		if (this->_edges.empty()) this->_weight_sum = 0;
+		return true;
+	}
+
+	bool Graph::remove(const Node& node)
+	{
+		auto iter = this->_nodes.find(node.id());
+		if (iter == this->_nodes.end()) return false;
+		for (const Edge& edge : *iter)
+		{
+			this->forget(edge);
+			this->_edges.erase(edge.id());
+		}
+		// Incoming edges, loop is already removed as outgoing one
+		std::vector<Edge> incoming;
+		// Probing is random access, scan is sequential - probing pays off only if there're many more edges than nodes
+		if (this->_edges.size() < 16 * this->_nodes.size())
+		{
+			for (const Edge& edge : this->_edges) { if (edge.target() == node) incoming.push_back(edge); }
+		}
+		else
+		{
+			for (const NodeInGraph& source : this->_nodes)
+			{
+				if (source == node) continue;
+				auto found = this->_edges.find(Edge(source, node).id());
+				if (found != this->_edges.end()) incoming.push_back(*found);
+			}
+		}
+		for (const Edge& edge : incoming) { this->remove(edge); }
+		this->_nodes.erase(node.id());
+		this->_fingerprint = this->_fingerprint ^ Graph::Fingerprint(node);
+		if (this->_edges.empty()) this->_weight_sum = 0;
 		return true;
 	}
 
+	size_t Graph::remove_nodes(const std::vector<Node>& nodes)
+	{
+		std::unordered_set<uint32_t> removed;
+		removed.reserve(nodes.size());
+		for (const Node& node : nodes) { if (this->has(node)) removed.insert(node.id()); }
+		if (removed.empty()) return 0;
+
+		Map::base_map<uint64_t, Edge>& edges = this->_edges;
+		for (auto iter = edges.begin(); iter != edges.end();)
+		{
+			const Edge& edge = iter->second;
+			const bool source = removed.count(edge.source().id());
+			if (!source && !removed.count(edge.target().id())) { ++iter; continue; }
+			this->forget(edge);
+			if (!source) (*this->_nodes.find(edge.source().id())).remove(edge);
+			iter = edges.erase(iter);
+		}
+		for (const uint32_t& id : removed)
+		{
+			this->_nodes.erase(id);
+			this->_fingerprint = this->_fingerprint ^ Graph::Fingerprint(Node(id));
+		}
+		if (this->_edges.empty()) this->_weight_sum = 0;
+		this->compact();
+		return removed.size();
+	}
+
+	size_t Graph::remove_edges_if(const std::function<bool(const Edge& edge)>& predicate)
+	{
+		size_t count = 0;
+		Map::base_map<uint64_t, Edge>& edges = this->_edges;
+		for (auto iter = edges.begin(); iter != edges.end();)
+		{
+			const Edge& edge = iter->second;
+			if (!predicate(edge)) { ++iter; continue; }
+			this->forget(edge);
+			(*this->_nodes.find(edge.source().id())).remove(edge);
+			iter = edges.erase(iter);
+			count++;
+		}
+		if (this->_edges.empty()) this->_weight_sum = 0;
+		if (count) this->compact();
+		return count;
+	}
+
+	void Graph::compact(void)
+	{
+		if (this->_nodes.size() < this->_nodes.bucket_count() / 4) this->_nodes.shrink();
+		if (this->_edges.size() < this->_edges.bucket_count() / 4) this->_edges.shrink();
+		for (NodeInGraph& node : this->_nodes) { node.compact(); }
+	}
+
 	std::string Graph::str(void) const
 	{
 		std::string output = "[\n";
@@ -148,6 +293,7 @@ namespace HWDG
 		this->_weight_sum = 0;
 		this->_negative_edges = 0;
 		this->_loops = 0;
+		this->_fingerprint = 0;
 	}
 
 	double Graph::weight_sum(void) const
@@ -207,6 +353,11 @@ namespace HWDG
 		return this->_loops > 0;
 	}
 
+	uint64_t Graph::fingerprint(void) const
+	{
+		return this->_fingerprint;
+	}
+
 	Graph Graph::Transpose(void) const
 	{
 		Graph output;
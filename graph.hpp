@@ -13,6 +13,8 @@
 #include <string>
 #include <initializer_list>
 #include <iostream>
+#include <functional>
+#include <vector>
 		
 #include "custom_map.hpp"
 #include "node.hpp"
@@ -21,6 +23,9 @@
 
 namespace HWDG
 {
+	class GraphBuilder;
+	class Operations;
+
 	/**
 	* Representation of Graph.
 	* 
@@ -29,12 +34,20 @@ namespace HWDG
 	*/
 	class Graph
 	{
+		friend class GraphBuilder;
+		friend class Operations;
 		private:
 			Map::unordered_map<uint32_t, NodeInGraph> _nodes;
 			Map::unordered_map<uint64_t, Edge> _edges;
 			double _weight_sum;
 			unsigned int _negative_edges;
 			unsigned int _loops;
+			uint64_t _fingerprint;
+			void replace_weight(Edge& stored, const float& weight);
+			void forget(const Edge& stored);
+			// Contributions of single Node and Edge to fingerprint(). GraphBuilder uses them too, so graphs built either way have equal fingerprints.
+			static uint64_t Fingerprint(const Node& node);
+			static uint64_t Fingerprint(const Edge& edge);
 		public:
 			/**
 			* Get sum of weights of all edges within a Graph.
@@ -164,6 +177,39 @@ namespace HWDG
 			*/
 			bool remove(const Edge& edge); 
 			/**
+			* Remove Node from Graph, together with all edges coming out from it and coming into it.
+			* Graph doesn't store predecessors, so incoming edges are found by scanning all edges, or (in dense graphs, with many more edges than nodes) by probing map of edges for edge from every other Node.
+			* \param node Node you wish to remove.
+			* \return true if succeeded, false otherwise (most likely reason: there's no such node within Graph)
+			* \par Time complexity:
+			* \f$O(min(nodes, edges))\f$
+			*/
+			bool remove(const Node& node);
+			/**
+			* Remove nodes in bulk, together with all edges coming out from them and coming into them. Nodes that don't belong to Graph are ignored.
+			* All edges are scanned once (instead of searching for incoming edges of every Node separately), then storage is compacted with compact().
+			* \param nodes Nodes you wish to remove.
+			* \return Number of removed nodes.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			size_t remove_nodes(const std::vector<Node>& nodes);
+			/**
+			* Remove all edges satisfying predicate, then compact storage with compact(). Nodes are kept, even if they're left without edges.
+			* \param predicate Function (typically lambda expression) returning true for edges to be removed.
+			* \return Number of removed edges.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			size_t remove_edges_if(const std::function<bool(const Edge& edge)>& predicate);
+			/**
+			* Release memory left by removed nodes and edges: every internal map that is less than quarter full is fitted to its' content with Map::unordered_map::shrink().
+			* With HWDG_ARENA_ALLOCATOR elements of such maps are moved, so references to them are invalidated.
+			* \par Time complexity:
+			* \f$O(nodes + edges)\f$
+			*/
+			void compact(void);
+			/**
 			* Update (weight of) edge.
 			* Replaces existing edge in graph, or adds it if it doesn't exist yet. Useful for changing weight of edge.
 			* \param edge Edge to be updated.
@@ -171,6 +217,30 @@ namespace HWDG
 			* \f$O(1)\f$
 			*/
 			void update(const Edge& edge); 
+			/**
+			* Change weight of existing edge, in place.
+			* Unlike Graph::update(), it never adds new edge. Graph::weight_sum() and Graph::has_negative_weights() are kept consistent.
+			* \param edge Edge with new weight.
+			* \return true if weight was changed, false if there's no such edge within Graph.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			bool update_weight(const Edge& edge);
+			/**
+			* Add weight of edge to existing edge, in place. If there's no such edge within Graph yet, it's added.
+			* \param edge Edge with weight to be added.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void accumulate(const Edge& edge);
+			/**
+			* Combine weight of edge with existing edge, in place. If there's no such edge within Graph yet, it's added.
+			* \param edge Edge with weight to be combined.
+			* \param combine Function (typically lambda expression) computing new weight out of weight stored in Graph and weight of edge.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void accumulate(const Edge& edge, const std::function<float(float stored, float incoming)>& combine);
 			
 			/**
 			* Get access to "list" of edges.
@@ -260,6 +330,14 @@ namespace HWDG
 			* \f$O(1)\f$
 			*/
 			bool has_loops(void) const; 
+			/**
+			* Get fingerprint of structure of the Graph: order-independent hash of its' nodes and edges, maintained on every addition and removal.
+			* Weights aren't included, so changing weight of Edge doesn't change fingerprint. Used to check whether structures built from Graph (for example ReachabilityIndex) are still valid.
+			* \return Fingerprint of structure of the Graph. Graphs with equal nodes and edges have equal fingerprints.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			uint64_t fingerprint(void) const;
 			
 			/**
 			* Transposition of Graph.
@@ -0,0 +1,195 @@
+
+#include <algorithm>
+#include <vector>
+#include "graph_builder.hpp"
+#include "node_in_graph.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		// Stable parallel merge sort: chunks are sorted independently, then pairs of sorted runs are merged, every merge split into independent pieces
+		template<typename TYPE, typename LESS>
+		void ParallelStableSort(std::vector<TYPE>& data, const LESS& less, ThreadPool& pool)
+		{
+			const size_t n = data.size();
+			const size_t chunks = std::max<size_t>(1, std::min(n / 65536, 4 * pool.size()));
+			const size_t width = (n + chunks - 1) / chunks;
+			pool.ParallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+				for (size_t chunk = first; chunk < last; ++chunk)
+				{
+					std::stable_sort(data.begin() + std::min(n, chunk * width), data.begin() + std::min(n, (chunk + 1) * width), less);
+				}
+			});
+			if (chunks == 1) return;
+
+			std::vector<TYPE> buffer(n);
+			TYPE* source = data.data();
+			TYPE* target = buffer.data();
+			for (size_t run = width; run < n; run = run * 2)
+			{
+				const size_t pairs = (n + 2 * run - 1) / (2 * run);
+				const size_t pieces = std::max<size_t>(1, 4 * pool.size() / pairs);
+				pool.ParallelFor(0, pairs * pieces, 1, [&](size_t first, size_t last) {
+					for (size_t task = first; task < last; ++task)
+					{
+						const size_t pair = task / pieces;
+						const size_t piece = task % pieces;
+						const size_t a_begin = pair * 2 * run;
+						const size_t a_end = std::min(n, a_begin + run);
+						const size_t b_end = std::min(n, a_begin + 2 * run);
+						// Split left run evenly, right run at matching keys. Elements of left run go first among equal ones, so merge stays stable.
+						auto split = [&](const size_t& position) {
+							if (position == a_end) return b_end;
+							return static_cast<size_t>(std::lower_bound(source + a_end, source + b_end, source[position], less) - source);
+						};
+						const size_t a_first = a_begin + (a_end - a_begin) * piece / pieces;
+						const size_t a_last = a_begin + (a_end - a_begin) * (piece + 1) / pieces;
+						const size_t b_first = (piece == 0) ? a_end : split(a_first);
+						const size_t b_last = (piece + 1 == pieces) ? b_end : split(a_last);
+						std::merge(source + a_first, source + a_last, source + b_first, source + b_last, target + a_first + (b_first - a_end), less);
+					}
+				});
+				std::swap(source, target);
+			}
+			if (source != data.data()) data.swap(buffer);
+		}
+	}
+
+	GraphBuilder::GraphBuilder(const Policy& policy) : _policy(policy) {}
+
+	void GraphBuilder::reserve(const size_t& count)
+	{
+		this->_edges.reserve(count);
+	}
+
+	size_t GraphBuilder::size(void) const
+	{
+		return this->_edges.size();
+	}
+
+	void GraphBuilder::add(const Node& node)
+	{
+		this->_nodes.push_back(node.id());
+	}
+
+	void GraphBuilder::add(const Edge& edge)
+	{
+		this->add(edge.source().id(), edge.target().id(), edge.weight());
+	}
+
+	void GraphBuilder::add(const uint32_t& source, const uint32_t& target, const float& weight)
+	{
+		this->_edges.push_back({ (static_cast<uint64_t>(source) << 32) | target, weight });
+	}
+
+	void GraphBuilder::add(const uint32_t* sources, const uint32_t* targets, const float* weights, const size_t& count)
+	{
+		this->_edges.reserve(this->_edges.size() + count);
+		for (size_t i = 0; i < count; ++i) { this->add(sources[i], targets[i], weights[i]); }
+	}
+
+	size_t GraphBuilder::ReadTxt(std::istream& file)
+	{
+		size_t count = 0;
+		uint32_t source = 0;
+		uint32_t target = 0;
+		float weight = 0;
+		while (file >> source >> target >> weight)
+		{
+			this->add(source, target, weight);
+			count++;
+		}
+		return count;
+	}
+
+	void GraphBuilder::Deduplicate(ThreadPool& pool)
+	{
+		ParallelStableSort(this->_edges, [](const std::pair<uint64_t, float>& l, const std::pair<uint64_t, float>& r) { return l.first < r.first; }, pool);
+		// Duplicates are adjacent, in order of addition
+		size_t output = 0;
+		for (size_t i = 0; i < this->_edges.size();)
+		{
+			std::pair<uint64_t, float> edge = this->_edges[i];
+			for (++i; i < this->_edges.size() && this->_edges[i].first == edge.first; ++i)
+			{
+				const float weight = this->_edges[i].second;
+				switch (this->_policy)
+				{
+					case Policy::First: break;
+					case Policy::Last: edge.second = weight; break;
+					case Policy::Sum: edge.second = edge.second + weight; break;
+					case Policy::Min: edge.second = std::min(edge.second, weight); break;
+				}
+			}
+			this->_edges[output++] = edge;
+		}
+		this->_edges.resize(output);
+
+		std::sort(this->_nodes.begin(), this->_nodes.end());
+		this->_nodes.erase(std::unique(this->_nodes.begin(), this->_nodes.end()), this->_nodes.end());
+	}
+
+	Graph GraphBuilder::Build(ThreadPool& pool)
+	{
+		this->Deduplicate(pool);
+		const std::vector<std::pair<uint64_t, float>>& edges = this->_edges;
+
+		// Every identifier exactly once: targets, sources (already grouped) and isolated nodes
+		std::vector<uint32_t> ids;
+		ids.reserve(edges.size() + this->_nodes.size());
+		for (const auto& edge : edges) { ids.push_back(static_cast<uint32_t>(edge.first)); }
+		std::vector<size_t> runs;
+		for (size_t i = 0; i < edges.size(); ++i)
+		{
+			if (i == 0 || (edges[i].first >> 32) != (edges[i - 1].first >> 32))
+			{
+				runs.push_back(i);
+				ids.push_back(static_cast<uint32_t>(edges[i].first >> 32));
+			}
+		}
+		runs.push_back(edges.size());
+		ids.insert(ids.end(), this->_nodes.begin(), this->_nodes.end());
+		ParallelStableSort(ids, std::less<uint32_t>(), pool);
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+		Graph output;
+		output._nodes.reserve(ids.size());
+		for (const uint32_t& id : ids)
+		{
+			output._nodes.emplace(id, NodeInGraph(Node(id)));
+			output._fingerprint = output._fingerprint ^ Graph::Fingerprint(Node(id));
+		}
+		std::vector<NodeInGraph*> sources(runs.size() - 1);
+		for (size_t run = 0; run + 1 < runs.size(); ++run) { sources[run] = &(*output._nodes.find(static_cast<uint32_t>(edges[runs[run]].first >> 32))); }
+
+		// Global map of edges is filled by single task, while maps of nodes are filled in parallel
+		ThreadPool::TaskGroup group;
+		pool.Spawn(group, [&]() {
+			output._edges.reserve(edges.size());
+			for (const auto& pair : edges)
+			{
+				const Edge edge(Node(static_cast<uint32_t>(pair.first >> 32)), Node(static_cast<uint32_t>(pair.first)), pair.second);
+				output._edges.emplace(edge.id(), edge);
+				if (edge.weight() < 0) { output._negative_edges++; }
+				if (edge.source() == edge.target()) { output._loops++; }
+				output._weight_sum = output._weight_sum + edge.weight();
+				output._fingerprint = output._fingerprint ^ Graph::Fingerprint(edge);
+			}
+		});
+		pool.ParallelFor(0, sources.size(), 64, [&](size_t first, size_t last) {
+			for (size_t run = first; run < last; ++run)
+			{
+				NodeInGraph& node = *sources[run];
+				node._edges.reserve(runs[run + 1] - runs[run]);
+				for (size_t i = runs[run]; i < runs[run + 1]; ++i)
+				{
+					const Edge edge(node, Node(static_cast<uint32_t>(edges[i].first)), edges[i].second);
+					node._edges.emplace(edge.id(), edge);
+				}
+			}
+		});
+		pool.Wait(group);
+		return output;
+	}
+}
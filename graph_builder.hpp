@@ -0,0 +1,130 @@
+#ifndef HWDG_GRAPH_BUILDER_HPP
+#define HWDG_GRAPH_BUILDER_HPP
+
+/**
+* @file graph_builder.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Bulk construction of Graph.
+*
+* This file contains GraphBuilder class, which collects large arrays or streams of edges and constructs Graph out of them in one pass.
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Bulk builder of Graph.
+	*
+	* Graph::add(const Edge&) performs several hash lookups per edge, and maps of Graph are rehashed many times while it grows. 
+	* GraphBuilder only appends edges to array. Build() sorts them in parallel, resolves duplicates, counts degrees and reserves exact capacity of every map, 
+	* then inserts every Node and Edge exactly once, without checking for duplicates. Edges of different nodes are inserted in parallel.
+	*/
+	class GraphBuilder
+	{
+		public:
+			/**
+			* What to do with duplicated edges (edges with the same source and target).
+			*/
+			enum class Policy
+			{
+				First, ///< Keep weight of the first added edge.
+				Last, ///< Keep weight of the last added edge, like Graph::update()
+				Sum, ///< Add weights, like Graph::accumulate() and Operations::Union(const Graph&, const Graph&)
+				Min ///< Keep the lowest weight.
+			};
+		private:
+			// Edge as (source << 32 | target, weight), so sorting by key groups edges by source
+			std::vector<std::pair<uint64_t, float>> _edges;
+			std::vector<uint32_t> _nodes;
+			Policy _policy;
+		private:
+			void Deduplicate(ThreadPool& pool);
+		public:
+			/**
+			* Create empty builder.
+			* \param policy Policy applied to duplicated edges.
+			*/
+			GraphBuilder(const Policy& policy = Policy::Last);
+
+			/**
+			* Reserve memory for given number of edges.
+			* \param count Number of edges that will be added.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			void reserve(const size_t& count);
+
+			/**
+			* Get number of collected edges, including duplicates that aren't resolved yet.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size(void) const;
+
+			/**
+			* Add Node, even if no Edge is connected to it.
+			* \param node Node to be added.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void add(const Node& node);
+
+			/**
+			* Add Edge. Its' source and target are added automatically.
+			* \param edge Edge to be added.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void add(const Edge& edge);
+
+			/**
+			* Add Edge. Its' source and target are added automatically.
+			* \param source Identifier of source Node.
+			* \param target Identifier of target Node.
+			* \param weight Weight of Edge.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void add(const uint32_t& source, const uint32_t& target, const float& weight);
+
+			/**
+			* Add edges in bulk, from three parallel arrays.
+			* \param sources Identifiers of source nodes.
+			* \param targets Identifiers of target nodes.
+			* \param weights Weights of edges.
+			* \param count Number of edges (length of every array).
+			* \par Time complexity:
+			* \f$O(count)\f$
+			*/
+			void add(const uint32_t* sources, const uint32_t* targets, const float* weights, const size_t& count);
+
+			/**
+			* Add edges from stream - text form, whitespace-separated triples "source target weight", until end of stream or first malformed triple.
+			* \param file Reference to istream-like object.
+			* \return Number of added edges.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			size_t ReadTxt(std::istream& file);
+
+			/**
+			* Construct Graph out of collected nodes and edges. Builder keeps its' content (with duplicates already resolved), so more edges can be added and Build() called again.
+			* \param pool ThreadPool sorting edges and filling maps of nodes.
+			* \return Graph containing all collected nodes and edges.
+			* \par Time complexity:
+			* \f$O(\frac{edges * log(edges)}{threads} + nodes + edges)\f$
+			*/
+			Graph Build(ThreadPool& pool = ThreadPool::Default());
+	};
+}
+
+#endif
@@ -14,12 +14,30 @@
 #include "edge.hpp"
 #include "node_in_graph.hpp"
 #include "graph.hpp"
+#include "graph_builder.hpp"
+#include "sorted_graph.hpp"
+#include "compact_graph.hpp"
 #include "tools.hpp"
 #include "operations.hpp"
+#include "accumulator.hpp"
+#include "similarity.hpp"
+#include "sketch.hpp"
 #include "path.hpp"
 #include "bellmanford.hpp"
+#include "dagpathfinding.hpp"
 #include "dijkstra.hpp"
 #include "bfspathfinding.hpp"
+#include "threadpool.hpp"
+#include "batchpathfinding.hpp"
+#include "views.hpp"
+#include "components.hpp"
+#include "reachability.hpp"
+#include "centrality.hpp"
+#include "clustering.hpp"
+#include "communities.hpp"
+#include "flow.hpp"
+#include "spanning.hpp"
+#include "random_walk.hpp"
 
 /**
 * Main namespace of library. 
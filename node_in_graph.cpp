@@ -34,6 +34,14 @@ namespace HWDG
 		return false;
 	}
 
+	bool NodeInGraph::update_weight(const Edge& edge)
+	{
+		auto iter = this->_edges.find(edge.id());
+		if (iter == this->_edges.end()) return false;
+		(*iter) = edge;
+		return true;
+	}
+
 	Map::const_iterator<uint64_t, Edge> NodeInGraph::begin() const
 	{
 		return this->_edges.cbegin();
@@ -70,4 +78,9 @@ namespace HWDG
 			this->_edges.reserve(count);
 		}
 	}
+
+	void NodeInGraph::compact(void)
+	{
+		if (this->_edges.size() < this->_edges.bucket_count() / 4) this->_edges.shrink();
+	}
 }
@@ -18,12 +18,17 @@
 
 namespace HWDG
 {
+	class GraphBuilder;
+	class Operations;
+
 	/**
 	* Representation of node/vertex inside Graph's context. 
 	* Aside from current Node, it includes list of Edge s coming out from this node.
 	*/
 	class NodeInGraph : public Node
 	{
+		friend class GraphBuilder;
+		friend class Operations;
 		private:
 			Map::unordered_map<uint64_t, Edge> _edges;
 		public:
@@ -61,6 +66,15 @@ namespace HWDG
 			* \f$O(1)\f$
 			*/
 			bool remove(const Edge& edge); // constant
+
+			/**
+			* Change weight of Edge coming out from this node, in place.
+			* \param edge Edge with new weight.
+			* \return true if weight was changed, false if there's no such edge.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			bool update_weight(const Edge& edge); // constant
 			
 			/**
 			* Support for C++ range loops.
@@ -107,6 +121,13 @@ namespace HWDG
 			* \param count Total number of edges that can be stored in internal list (map) 
 			*/
 			void reserve_edges(const size_t& count);
+
+			/**
+			* Release memory left by removed edges: internal map is fitted to its' content with Map::unordered_map::shrink(), if it's less than quarter full.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			void compact(void);
 	};
 
 }
@@ -5,6 +5,8 @@
 #include <stack>
 #include <functional>
 #include <vector>
+#include <iterator>
+#include <stdexcept>
 #include <algorithm>
 
 #include "operations.hpp"
@@ -12,10 +14,191 @@
 #include "edge.hpp"
 #include "node_in_graph.hpp"
 #include "graph.hpp"
+#include "sorted_graph.hpp"
 #include "custom_map.hpp"
+#include "threadpool.hpp"
+#include "tools.hpp"
 
 namespace HWDG
 {
+	namespace
+	{
+		// Ids of nodes of a, followed by ids of nodes of b that don't belong to a
+		std::vector<uint32_t> SourceNodes(const Graph& a, const Graph& b)
+		{
+			std::vector<uint32_t> output;
+			output.reserve(a.size_nodes() + b.size_nodes());
+			for (const NodeInGraph& node : a) { output.push_back(node.id()); }
+			for (const NodeInGraph& node : b) { if (!a.has(node)) output.push_back(node.id()); }
+			return output;
+		}
+
+		// Set of node identifiers. Identifiers below limit are kept in bitset grown on demand, so memory stays proportional to size of graph even if identifiers are sparse.
+		class NodeBitset
+		{
+			private:
+				std::vector<uint64_t> _bits;
+				std::unordered_set<uint32_t> _sparse;
+				size_t _limit;
+			public:
+				explicit NodeBitset(const size_t& nodes) : _limit(64 * std::max<size_t>(nodes, 1024)) {}
+
+				bool insert(const uint32_t& id)
+				{
+					if (id >= this->_limit) return this->_sparse.insert(id).second;
+					const size_t word = id >> 6;
+					if (word >= this->_bits.size()) this->_bits.resize(std::max(word + 1, 2 * this->_bits.size()), 0);
+					const uint64_t mask = uint64_t(1) << (id & 63);
+					if (this->_bits[word] & mask) return false;
+					this->_bits[word] |= mask;
+					return true;
+				}
+
+				bool has(const uint32_t& id) const
+				{
+					if (id >= this->_limit) return this->_sparse.count(id);
+					const size_t word = id >> 6;
+					return word < this->_bits.size() && ((this->_bits[word] >> (id & 63)) & 1);
+				}
+		};
+
+		// Walks sorted edge arrays of both graphs at once. Callbacks receive indices into a._edges and b._edges.
+		template<typename BOTH, typename ONLY_A, typename ONLY_B>
+		void MergeEdges(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, BOTH both, ONLY_A only_a, ONLY_B only_b)
+		{
+			size_t i = 0;
+			size_t j = 0;
+			while (i < a.size() && j < b.size())
+			{
+				if (a[i] < b[j]) { only_a(i++); }
+				else if (b[j] < a[i]) { only_b(j++); }
+				else { both(i++, j++); }
+			}
+			while (i < a.size()) { only_a(i++); }
+			while (j < b.size()) { only_b(j++); }
+		}
+
+		// Nodes of output, extended by endpoints of its' edges - Graph::add(const Edge&) adds them as well
+		void AddEndpoints(std::vector<uint32_t>& nodes, const std::vector<Edge>& edges)
+		{
+			std::vector<uint32_t> endpoints;
+			endpoints.reserve(2 * edges.size());
+			for (const Edge& edge : edges)
+			{
+				endpoints.push_back(edge.source().id());
+				endpoints.push_back(edge.target().id());
+			}
+			std::sort(endpoints.begin(), endpoints.end());
+			endpoints.erase(std::unique(endpoints.begin(), endpoints.end()), endpoints.end());
+			std::vector<uint32_t> output;
+			output.reserve(nodes.size() + endpoints.size());
+			std::set_union(nodes.begin(), nodes.end(), endpoints.begin(), endpoints.end(), std::back_inserter(output));
+			nodes.swap(output);
+		}
+
+		// Subgraph induced by unique nodes, all of them belonging to both graph and members. Edges are counted first, so output is never rehashed.
+		Graph Extract(const Graph& graph, const std::vector<uint32_t>& nodes, const NodeBitset& members)
+		{
+			std::vector<size_t> counts(nodes.size(), 0);
+			size_t total = 0;
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				for (const Edge& edge : graph.fetch(Node(nodes[i]))) { if (members.has(edge.target().id())) counts[i]++; }
+				total = total + counts[i];
+			}
+			Graph output;
+			output.reserve_nodes(nodes.size());
+			output.reserve_edges(total);
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				output.add(Node(nodes[i]));
+				output.reserve_edges_in_node(Node(nodes[i]), counts[i]);
+			}
+			for (const uint32_t& id : nodes)
+			{
+				for (const Edge& edge : graph.fetch(Node(id))) { if (members.has(edge.target().id())) output.add(edge); }
+			}
+			return output;
+		}
+	}
+
+	// Edges coming out from every source node are generated in parallel by 'partition', then they're emplaced directly into maps of output, reserved for exact number of nodes and edges.
+	// 'nodes' are added to output even if there's no edge connected to them. Edges generated for single source must be unique.
+	Graph Operations::Assemble(const std::vector<uint32_t>& sources, const std::vector<uint32_t>& nodes, ThreadPool& pool,
+		const std::function<void(const Node& source, std::vector<Edge>& output)>& partition)
+	{
+		constexpr size_t grain = 256;
+		const size_t chunks = (sources.size() + grain - 1) / grain;
+		std::vector<std::vector<Edge>> edges(chunks);
+		std::vector<size_t> counts(sources.size(), 0);
+		pool.ParallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+			for (size_t chunk = first; chunk < last; ++chunk)
+			{
+				for (size_t i = chunk * grain; i < std::min(sources.size(), (chunk + 1) * grain); ++i)
+				{
+					const size_t before = edges[chunk].size();
+					partition(Node(sources[i]), edges[chunk]);
+					counts[i] = edges[chunk].size() - before;
+				}
+			}
+		});
+
+		// Every node of output exactly once: given nodes, sources with edges and targets of edges
+		NodeBitset seen(sources.size() + nodes.size());
+		std::vector<uint32_t> ids;
+		size_t total_edges = 0;
+		for (const uint32_t& id : nodes) { if (seen.insert(id)) ids.push_back(id); }
+		for (size_t i = 0; i < sources.size(); ++i) { if (counts[i] && seen.insert(sources[i])) ids.push_back(sources[i]); }
+		for (const auto& chunk : edges)
+		{
+			total_edges = total_edges + chunk.size();
+			for (const Edge& edge : chunk) { if (seen.insert(edge.target().id())) ids.push_back(edge.target().id()); }
+		}
+
+		Graph output;
+		output._nodes.reserve(ids.size());
+		for (const uint32_t& id : ids)
+		{
+			output._nodes.emplace(id, NodeInGraph(Node(id)));
+			output._fingerprint = output._fingerprint ^ Graph::Fingerprint(Node(id));
+		}
+		// Global map of edges is filled by single task, while maps of nodes are filled in parallel
+		ThreadPool::TaskGroup group;
+		pool.Spawn(group, [&]() {
+			output._edges.reserve(total_edges);
+			for (const auto& chunk : edges)
+			{
+				for (const Edge& edge : chunk)
+				{
+					output._edges.emplace(edge.id(), edge);
+					if (edge.weight() < 0) { output._negative_edges++; }
+					if (edge.source() == edge.target()) { output._loops++; }
+					output._weight_sum = output._weight_sum + edge.weight();
+					output._fingerprint = output._fingerprint ^ Graph::Fingerprint(edge);
+				}
+			}
+		});
+		pool.ParallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+			for (size_t chunk = first; chunk < last; ++chunk)
+			{
+				size_t position = 0;
+				for (size_t i = chunk * grain; i < std::min(sources.size(), (chunk + 1) * grain); ++i)
+				{
+					if (counts[i] == 0) continue;
+					NodeInGraph& node = *output._nodes.find(sources[i]);
+					node._edges.reserve(counts[i]);
+					for (size_t j = 0; j < counts[i]; ++j)
+					{
+						const Edge& edge = edges[chunk][position++];
+						node._edges.emplace(edge.id(), edge);
+					}
+				}
+			}
+		});
+		pool.Wait(group);
+		return output;
+	}
+
 	Graph Operations::Union(const Graph& a, const Graph& b)
 	{
 		Graph output = a;
@@ -38,20 +221,10 @@ namespace HWDG
 		{
 			a.add((const Node&)node);
 		}
-		// adding edges
+		// adding edges, weights of existing ones are updated in place
 		for (auto& edge : b.edges())
 		{
-			if (a.has(edge))
-			{
-				float weight_from_a = a.fetch(edge).weight();
-				float weight_from_b = edge.weight();
-				a.remove(edge);
-				a.add(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
-			}
-			else
-			{
-				a.add(edge);
-			}
+			a.accumulate(edge);
 		}
 	}
 	void Operations::MergeUnion(Graph& a, const Graph& b, float balancer)
@@ -61,20 +234,14 @@ namespace HWDG
 		{
 			a.add((const Node&)node);
 		}
-		// adding edges
+		// adding edges, weights of existing ones are updated in place
 		for (auto& edge : b.edges())
 		{
-			if (a.has(edge))
-			{
-				float weight_from_a = balancer * a.fetch(edge).weight();
-				float weight_from_b = ((float)1.0 - balancer) * edge.weight();
-				a.remove(edge);
-				a.add(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
-			}
-			else
-			{
-				a.add(edge);
-			}
+			a.accumulate(edge, [balancer](float stored, float incoming) {
+				float weight_from_a = balancer * stored;
+				float weight_from_b = ((float)1.0 - balancer) * incoming;
+				return weight_from_a + weight_from_b;
+			});
 		}
 	}
 
@@ -130,6 +297,143 @@ namespace HWDG
 		return output;
 	}
 
+	Graph Operations::ParallelUnion(const Graph& a, const Graph& b, ThreadPool& pool)
+	{
+		const std::vector<uint32_t> sources = SourceNodes(a, b);
+		return Operations::Assemble(sources, sources, pool, [&a, &b](const Node& source, std::vector<Edge>& output) {
+			auto in_a = a.get_node(source);
+			auto in_b = b.get_node(source);
+			if (in_a != a.end())
+			{
+				for (const Edge& edge : *in_a)
+				{
+					auto other = b.get_edge(edge);
+					if (other == b.edges().cend()) { output.push_back(edge); continue; }
+					output.push_back(Edge(edge.source(), edge.target(), edge.weight() + (*other).weight()));
+				}
+			}
+			if (in_b != b.end())
+			{
+				for (const Edge& edge : *in_b) { if (!a.has(edge)) output.push_back(edge); }
+			}
+		});
+	}
+
+	Graph Operations::ParallelUnion(const Graph& a, const Graph& b, float balancer, ThreadPool& pool)
+	{
+		const std::vector<uint32_t> sources = SourceNodes(a, b);
+		return Operations::Assemble(sources, sources, pool, [&a, &b, balancer](const Node& source, std::vector<Edge>& output) {
+			auto in_a = a.get_node(source);
+			auto in_b = b.get_node(source);
+			if (in_a != a.end())
+			{
+				for (const Edge& edge : *in_a)
+				{
+					auto other = b.get_edge(edge);
+					if (other == b.edges().cend()) { output.push_back(edge); continue; }
+					float weight_from_a = balancer * edge.weight();
+					float weight_from_b = ((float)1.0 - balancer) * (*other).weight();
+					output.push_back(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
+				}
+			}
+			if (in_b != b.end())
+			{
+				for (const Edge& edge : *in_b) { if (!a.has(edge)) output.push_back(edge); }
+			}
+		});
+	}
+
+	Graph Operations::ParallelIntersection(const Graph& a, const Graph& b, float balancer, ThreadPool& pool)
+	{
+		std::vector<uint32_t> sources;
+		sources.reserve(std::min(a.size_nodes(), b.size_nodes()));
+		for (const NodeInGraph& node : a) { if (b.has(node)) sources.push_back(node.id()); }
+		return Operations::Assemble(sources, sources, pool, [&a, &b, balancer](const Node& source, std::vector<Edge>& output) {
+			for (const Edge& edge : a.fetch(source))
+			{
+				auto other = b.get_edge(edge);
+				if (other == b.edges().cend()) continue;
+				float weight_from_a = balancer * edge.weight();
+				float weight_from_b = ((float)1.0 - balancer) * (*other).weight();
+				output.push_back(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
+			}
+		});
+	}
+
+	Graph Operations::ParallelInverseIntersection(const Graph& a, const Graph& b, ThreadPool& pool)
+	{
+		const std::vector<uint32_t> sources = SourceNodes(a, b);
+		std::vector<uint32_t> nodes;
+		for (auto& node : a.nodes()) { if (!b.has(node)) { nodes.push_back(node.id()); } }
+		for (auto& node : b.nodes()) { if (!a.has(node)) { nodes.push_back(node.id()); } }
+		return Operations::Assemble(sources, nodes, pool, [&a, &b](const Node& source, std::vector<Edge>& output) {
+			auto in_a = a.get_node(source);
+			auto in_b = b.get_node(source);
+			if (in_a != a.end())
+			{
+				for (const Edge& edge : *in_a) { if (!b.has(edge)) output.push_back(edge); }
+			}
+			if (in_b != b.end())
+			{
+				for (const Edge& edge : *in_b) { if (!a.has(edge)) output.push_back(edge); }
+			}
+		});
+	}
+
+	Graph Operations::ParallelDifference(const Graph& a, const Graph& b, ThreadPool& pool)
+	{
+		std::vector<uint32_t> sources;
+		std::vector<uint32_t> nodes;
+		sources.reserve(a.size_nodes());
+		for (const NodeInGraph& node : a)
+		{
+			sources.push_back(node.id());
+			if (!b.has(node)) nodes.push_back(node.id());
+		}
+		return Operations::Assemble(sources, nodes, pool, [&a, &b](const Node& source, std::vector<Edge>& output) {
+			for (const Edge& edge : a.fetch(source)) { if (!b.has(edge)) output.push_back(edge); }
+		});
+	}
+
+	Graph Operations::KHopSubgraph(const Graph& graph, const std::vector<Node>& seeds, const size_t& k)
+	{
+		NodeBitset visited(graph.size_nodes());
+		std::vector<uint32_t> nodes;
+		for (const Node& seed : seeds)
+		{
+			if (!graph.has(seed)) throw std::invalid_argument(Tools::string_format("KHopSubgraph: seed %u isn't part of given graph", seed.id()));
+			if (visited.insert(seed.id())) nodes.push_back(seed.id());
+		}
+		// Nodes of every hop are appended after previous ones, so [level_begin, level_end) is the current frontier
+		size_t level_begin = 0;
+		for (size_t hop = 0; hop < k && level_begin < nodes.size(); ++hop)
+		{
+			const size_t level_end = nodes.size();
+			for (size_t i = level_begin; i < level_end; ++i)
+			{
+				for (const Edge& edge : graph.fetch(Node(nodes[i])))
+				{
+					if (visited.insert(edge.target().id())) nodes.push_back(edge.target().id());
+				}
+			}
+			level_begin = level_end;
+		}
+		return Extract(graph, nodes, visited);
+	}
+
+	Graph Operations::InducedSubgraph(const Graph& graph, const std::vector<Node>& nodes)
+	{
+		NodeBitset members(graph.size_nodes());
+		std::vector<uint32_t> unique;
+		unique.reserve(nodes.size());
+		for (const Node& node : nodes)
+		{
+			if (!graph.has(node)) throw std::invalid_argument(Tools::string_format("InducedSubgraph: node %u isn't part of given graph", node.id()));
+			if (members.insert(node.id())) unique.push_back(node.id());
+		}
+		return Extract(graph, unique, members);
+	}
+
 	double Operations::SizeSimilarity(const Graph& a, const Graph& b)
 	{
 		double size_a = a.size_edges();
@@ -139,7 +443,14 @@ namespace HWDG
 
 	double Operations::ContainmentSimilarity(const Graph& a, const Graph& b)
 	{
-		double common_edges = Operations::Intersection(a,b,0.5).size_edges();
+		// Count common edges without building intersection, probing bigger graph with edges of smaller one
+		const Graph& smaller = (a.size_edges() < b.size_edges()) ? a : b;
+		const Graph& bigger = (a.size_edges() < b.size_edges()) ? b : a;
+		double common_edges = 0;
+		for (auto& edge : smaller.edges())
+		{
+			if (bigger.has(edge)) common_edges = common_edges + 1;
+		}
 		return common_edges / std::min(a.size_edges(), b.size_edges());
 	}
 	
@@ -163,6 +474,148 @@ namespace HWDG
 		return ValueSimilarity(a,b) / SizeSimilarity(a,b);
 	}
 
+	SortedGraph Operations::Union(const SortedGraph& a, const SortedGraph& b)
+	{
+		std::vector<uint32_t> nodes;
+		std::vector<uint64_t> ids;
+		std::vector<Edge> edges;
+		nodes.reserve(a._nodes.size() + b._nodes.size());
+		ids.reserve(a._ids.size() + b._ids.size());
+		edges.reserve(a._ids.size() + b._ids.size());
+		std::set_union(a._nodes.begin(), a._nodes.end(), b._nodes.begin(), b._nodes.end(), std::back_inserter(nodes));
+		MergeEdges(a._ids, b._ids,
+			[&](size_t i, size_t j) {
+				const Edge& edge = a._edges[i];
+				ids.push_back(a._ids[i]);
+				edges.push_back(Edge(edge.source(), edge.target(), edge.weight() + b._edges[j].weight()));
+			},
+			[&](size_t i) { ids.push_back(a._ids[i]); edges.push_back(a._edges[i]); },
+			[&](size_t j) { ids.push_back(b._ids[j]); edges.push_back(b._edges[j]); });
+		return SortedGraph(std::move(nodes), std::move(ids), std::move(edges));
+	}
+
+	SortedGraph Operations::Union(const SortedGraph& a, const SortedGraph& b, float balancer)
+	{
+		std::vector<uint32_t> nodes;
+		std::vector<uint64_t> ids;
+		std::vector<Edge> edges;
+		nodes.reserve(a._nodes.size() + b._nodes.size());
+		ids.reserve(a._ids.size() + b._ids.size());
+		edges.reserve(a._ids.size() + b._ids.size());
+		std::set_union(a._nodes.begin(), a._nodes.end(), b._nodes.begin(), b._nodes.end(), std::back_inserter(nodes));
+		MergeEdges(a._ids, b._ids,
+			[&](size_t i, size_t j) {
+				const Edge& edge = a._edges[i];
+				float weight_from_a = balancer * edge.weight();
+				float weight_from_b = ((float)1.0 - balancer) * b._edges[j].weight();
+				ids.push_back(a._ids[i]);
+				edges.push_back(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
+			},
+			[&](size_t i) { ids.push_back(a._ids[i]); edges.push_back(a._edges[i]); },
+			[&](size_t j) { ids.push_back(b._ids[j]); edges.push_back(b._edges[j]); });
+		return SortedGraph(std::move(nodes), std::move(ids), std::move(edges));
+	}
+
+	SortedGraph Operations::Intersection(const SortedGraph& a, const SortedGraph& b, float balancer)
+	{
+		std::vector<uint32_t> nodes;
+		std::vector<uint64_t> ids;
+		std::vector<Edge> edges;
+		nodes.reserve(std::min(a._nodes.size(), b._nodes.size()));
+		ids.reserve(std::min(a._ids.size(), b._ids.size()));
+		edges.reserve(std::min(a._ids.size(), b._ids.size()));
+		// Endpoints of common edges are common nodes, so there's no need to add them
+		std::set_intersection(a._nodes.begin(), a._nodes.end(), b._nodes.begin(), b._nodes.end(), std::back_inserter(nodes));
+		MergeEdges(a._ids, b._ids,
+			[&](size_t i, size_t j) {
+				const Edge& edge = a._edges[i];
+				float weight_from_a = balancer * edge.weight();
+				float weight_from_b = ((float)1.0 - balancer) * b._edges[j].weight();
+				ids.push_back(a._ids[i]);
+				edges.push_back(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
+			},
+			[](size_t) {},
+			[](size_t) {});
+		return SortedGraph(std::move(nodes), std::move(ids), std::move(edges));
+	}
+
+	SortedGraph Operations::InverseIntersection(const SortedGraph& a, const SortedGraph& b)
+	{
+		std::vector<uint32_t> nodes;
+		std::vector<uint64_t> ids;
+		std::vector<Edge> edges;
+		std::set_symmetric_difference(a._nodes.begin(), a._nodes.end(), b._nodes.begin(), b._nodes.end(), std::back_inserter(nodes));
+		MergeEdges(a._ids, b._ids,
+			[](size_t, size_t) {},
+			[&](size_t i) { ids.push_back(a._ids[i]); edges.push_back(a._edges[i]); },
+			[&](size_t j) { ids.push_back(b._ids[j]); edges.push_back(b._edges[j]); });
+		AddEndpoints(nodes, edges);
+		return SortedGraph(std::move(nodes), std::move(ids), std::move(edges));
+	}
+
+	SortedGraph Operations::Difference(const SortedGraph& a, const SortedGraph& b)
+	{
+		std::vector<uint32_t> nodes;
+		std::vector<uint64_t> ids;
+		std::vector<Edge> edges;
+		std::set_difference(a._nodes.begin(), a._nodes.end(), b._nodes.begin(), b._nodes.end(), std::back_inserter(nodes));
+		MergeEdges(a._ids, b._ids,
+			[](size_t, size_t) {},
+			[&](size_t i) { ids.push_back(a._ids[i]); edges.push_back(a._edges[i]); },
+			[](size_t) {});
+		AddEndpoints(nodes, edges);
+		return SortedGraph(std::move(nodes), std::move(ids), std::move(edges));
+	}
+
+	double Operations::ContainmentSimilarity(const SortedGraph& a, const SortedGraph& b)
+	{
+		// Branchless merge: compiler turns comparisons into conditional moves, so the loop doesn't suffer from mispredictions
+		const uint64_t* ids_a = a._ids.data();
+		const uint64_t* ids_b = b._ids.data();
+		const size_t size_a = a._ids.size();
+		const size_t size_b = b._ids.size();
+		size_t i = 0;
+		size_t j = 0;
+		size_t common_edges = 0;
+		while (i < size_a && j < size_b)
+		{
+			const uint64_t x = ids_a[i];
+			const uint64_t y = ids_b[j];
+			common_edges += (x == y);
+			i += (x <= y);
+			j += (y <= x);
+		}
+		return (double)common_edges / std::min(size_a, size_b);
+	}
+
+	double Operations::SizeSimilarity(const SortedGraph& a, const SortedGraph& b)
+	{
+		double size_a = a.size_edges();
+		double size_b = b.size_edges();
+		return std::min(size_a, size_b) / std::max(size_a, size_b);
+	}
+
+	double Operations::ValueSimilarity(const SortedGraph& a, const SortedGraph& b)
+	{
+		double output = 0;
+		MergeEdges(a._ids, b._ids,
+			[&](size_t i, size_t j) {
+				const float weight_a = a._edges[i].weight();
+				const float weight_b = b._edges[j].weight();
+				double tmp_nom = std::min(weight_a, weight_b);
+				double tmp_denom = std::max(weight_a, weight_b);
+				output = output + tmp_nom / tmp_denom;
+			},
+			[](size_t) {},
+			[](size_t) {});
+		return output / std::max(a.size_edges(), b.size_edges());
+	}
+
+	double Operations::NormalizedValueSimilarity(const SortedGraph& a, const SortedGraph& b)
+	{
+		return ValueSimilarity(a, b) / SizeSimilarity(a, b);
+	}
+
 	void Operations::BreadthFirstSearch(const Graph& graph, const Node& starting_node, std::function<void(const Edge& edge, const std::unordered_set<Node, Node::HashFunction>& visited)> func)
 	{
 		Operations::BreadthFirstSearch(graph, starting_node, func, [](const NodeInGraph& node, std::vector<Edge>& to_be_visited_first, const std::unordered_set<Node, Node::HashFunction>& visited) {
@@ -12,6 +12,8 @@
 #include <unordered_set>
 #include <vector>
 #include "graph.hpp"
+#include "sorted_graph.hpp"
+#include "threadpool.hpp"
 
 namespace HWDG
 {
@@ -21,6 +23,10 @@ namespace HWDG
 	*/
 	class Operations
 	{
+		private:
+			// Output of parallel set operations: edges of every source Node are generated in parallel by 'partition', then emplaced directly into internal maps of Graph
+			static Graph Assemble(const std::vector<uint32_t>& sources, const std::vector<uint32_t>& nodes, ThreadPool& pool,
+				const std::function<void(const Node& source, std::vector<Edge>& output)>& partition);
 		public:
 			Operations() = delete;
 		public:
@@ -130,6 +136,97 @@ namespace HWDG
 			*/
 			static Graph Difference(const Graph& a, const Graph& b); // linear
 
+			/**
+			* Parallel graph union with edge-weight addition.
+			* Result is identical to Union(const Graph&, const Graph&).
+			*
+			* Work is partitioned by source Node: edges coming out from each Node are computed in parallel, then output Graph is assembled with memory reserved up front.
+			* \param a Graph A, one of components for union (sum)
+			* \param b Graph B, one of components for union (sum)
+			* \param pool ThreadPool executing the operation.
+			* \return Graph consisting of all nodes and edges existing in either a or b, with weight computed by algorithm.
+			* \par Time complexity:
+			* \f$O(\frac{edges}{threads})\f$ for partitions, plus \f$O(edges)\f$ for assembly.
+			*/
+			static Graph ParallelUnion(const Graph& a, const Graph& b, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Parallel graph union with edge-weight balancer.
+			* Result is identical to Union(const Graph&, const Graph&, float). Check ParallelUnion(const Graph&, const Graph&, ThreadPool&) for details.
+			* \param a Graph A, one of components for union (sum)
+			* \param b Graph B, one of components for union (sum)
+			* \param balancer Balancing factor used in weight computation. MUST belong to [0,1]
+			* \param pool ThreadPool executing the operation.
+			* \return Graph consisting of all nodes and edges existing in either a or b, with weight computed by algorithm.
+			* \par Time complexity:
+			* \f$O(\frac{edges}{threads})\f$ for partitions, plus \f$O(edges)\f$ for assembly.
+			*/
+			static Graph ParallelUnion(const Graph& a, const Graph& b, float balancer, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Parallel graph intersection, with edge-weight balancer.
+			* Result is identical to Intersection(). Check ParallelUnion(const Graph&, const Graph&, ThreadPool&) for details.
+			* \param a Graph A, one of component for intersection
+			* \param b Graph B, one of component for intersection
+			* \param balancer Balancing factor used in weight computation. MUST belong to [0,1]
+			* \param pool ThreadPool executing the operation.
+			* \return Graph that consists only of nodes and edges that belong to both A and B
+			* \par Time complexity:
+			* \f$O(\frac{edges}{threads})\f$ for partitions, plus \f$O(edges)\f$ for assembly.
+			*/
+			static Graph ParallelIntersection(const Graph& a, const Graph& b, float balancer, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Parallel inverse of intersection.
+			* Result is identical to InverseIntersection(). Check ParallelUnion(const Graph&, const Graph&, ThreadPool&) for details.
+			* \param a Graph A, one of component for inverse intersection
+			* \param b Graph B, one of component for inverse intersection
+			* \param pool ThreadPool executing the operation.
+			* \return Graph that consists only of nodes and edges that belong to either A and B, but not both at the same time.
+			* \par Time complexity:
+			* \f$O(\frac{edges}{threads})\f$ for partitions, plus \f$O(edges)\f$ for assembly.
+			*/
+			static Graph ParallelInverseIntersection(const Graph& a, const Graph& b, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Parallel graph difference.
+			* Result is identical to Difference(). Check ParallelUnion(const Graph&, const Graph&, ThreadPool&) for details.
+			* \param a Graph A, left-side graph (minuend) that B will be "substracted" from.
+			* \param b Graph B, right-side graph (subtrahend)
+			* \param pool ThreadPool executing the operation.
+			* \return Graph consisting of those edges and nodes that belong to A, but NOT to B.
+			* \par Time complexity:
+			* \f$O(\frac{edges}{threads})\f$ for partitions, plus \f$O(edges)\f$ for assembly.
+			*/
+			static Graph ParallelDifference(const Graph& a, const Graph& b, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Subgraph induced by k-hop neighbourhood of seeds: nodes reachable from any seed by at most k edges (following their direction), and all edges between them.
+			*
+			* Visited nodes are tracked by bitset indexed by identifier, and memory of output Graph is reserved before nodes and edges are added, so it's never rehashed.
+			* \param graph Graph to extract subgraph from.
+			* \param seeds Nodes the neighbourhood is centered at.
+			* \param k Maximal number of hops. 0 returns subgraph induced by seeds only.
+			* \return Subgraph containing neighbourhood of seeds.
+			* \throws std::invalid_argument if any of seeds doesn't belong to graph.
+			* \par Time complexity:
+			* \f$O(nodes_{sub} + edges_{sub})\f$, where edges include edges coming out from neighbourhood.
+			*/
+			static Graph KHopSubgraph(const Graph& graph, const std::vector<Node>& seeds, const size_t& k);
+
+			/**
+			* Subgraph induced by set of nodes: given nodes, and all edges of graph between them.
+			*
+			* Membership is checked with bitset indexed by identifier, and memory of output Graph is reserved before nodes and edges are added, so it's never rehashed.
+			* \param graph Graph to extract subgraph from.
+			* \param nodes Nodes of subgraph. Duplicates are allowed.
+			* \return Induced subgraph.
+			* \throws std::invalid_argument if any of nodes doesn't belong to graph.
+			* \par Time complexity:
+			* \f$O(nodes_{sub} + edges_{sub})\f$, where edges include edges coming out from given nodes.
+			*/
+			static Graph InducedSubgraph(const Graph& graph, const std::vector<Node>& nodes);
+
 			/**
 			* Containment Similarity (CS) comparison of graphs.
 			* Algorithm: \f$ CS(A,B) = \frac{\sum\nolimits_{e \in A \cap B} 1}{min(|A|,|B|)} \f$
@@ -188,6 +285,103 @@ namespace HWDG
 			*/
 			static double NormalizedValueSimilarity(const Graph& a, const Graph& b); // linear
 
+			/**
+			* Graph union with edge-weight addition, computed as merge of sorted arrays.
+			* Result is identical to Union(const Graph&, const Graph&).
+			* \param a Graph A, one of components for union (sum)
+			* \param b Graph B, one of components for union (sum)
+			* \return Snapshot consisting of all nodes and edges existing in either a or b.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static SortedGraph Union(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Graph union with edge-weight balancer, computed as merge of sorted arrays.
+			* Result is identical to Union(const Graph&, const Graph&, float).
+			* \param a Graph A, one of components for union (sum)
+			* \param b Graph B, one of components for union (sum)
+			* \param balancer Balancing factor used in weight computation. MUST belong to [0,1]
+			* \return Snapshot consisting of all nodes and edges existing in either a or b.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static SortedGraph Union(const SortedGraph& a, const SortedGraph& b, float balancer);
+
+			/**
+			* Graph intersection with edge-weight balancer, computed as merge of sorted arrays.
+			* Result is identical to Intersection(const Graph&, const Graph&, float).
+			* \param a Graph A, one of component for intersection
+			* \param b Graph B, one of component for intersection
+			* \param balancer Balancing factor used in weight computation. MUST belong to [0,1]
+			* \return Snapshot that consists only of nodes and edges that belong to both A and B
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static SortedGraph Intersection(const SortedGraph& a, const SortedGraph& b, float balancer);
+
+			/**
+			* Inverse of intersection, computed as merge of sorted arrays.
+			* Result is identical to InverseIntersection(const Graph&, const Graph&).
+			* \param a Graph A, one of component for inverse intersection
+			* \param b Graph B, one of component for inverse intersection
+			* \return Snapshot that consists only of nodes and edges that belong to either A and B, but not both at the same time.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static SortedGraph InverseIntersection(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Graph difference, computed as merge of sorted arrays.
+			* Result is identical to Difference(const Graph&, const Graph&).
+			* \param a Graph A, left-side graph (minuend) that B will be "substracted" from.
+			* \param b Graph B, right-side graph (subtrahend)
+			* \return Snapshot consisting of those edges and nodes that belong to A, but NOT to B.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static SortedGraph Difference(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Containment Similarity (CS), computed as merge of sorted arrays. Check ContainmentSimilarity(const Graph&, const Graph&)
+			* \param a Graph A
+			* \param b Graph B
+			* \return Result of CS algorithm, belongs to [0,1]
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static double ContainmentSimilarity(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Size Similarity (SS). Check SizeSimilarity(const Graph&, const Graph&)
+			* \param a Graph A
+			* \param b Graph B
+			* \return Result of SS algorithm, belongs to [0,1]
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			static double SizeSimilarity(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Value Similarity (VS), computed as merge of sorted arrays. Check ValueSimilarity(const Graph&, const Graph&)
+			* \param a Graph A
+			* \param b Graph B
+			* \return Result of VS algorithm, belongs to [0,1]
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static double ValueSimilarity(const SortedGraph& a, const SortedGraph& b);
+
+			/**
+			* Normalized Value Similarity (NVS), computed as merge of sorted arrays. Check NormalizedValueSimilarity(const Graph&, const Graph&)
+			* \param a Graph A
+			* \param b Graph B
+			* \return Result of NVS algorithm
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			static double NormalizedValueSimilarity(const SortedGraph& a, const SortedGraph& b);
+
 			/**
 			* Breadth First Search (BFS) of graph.
 			* BFS traverses graph's nodes in such a way that each Node is visited only once and with minimal number of traversals (weight isn't considered here, only number of traversals)
@@ -2,6 +2,7 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <algorithm>
 #include "node.hpp"
 #include "edge.hpp"
 #include "path.hpp"
@@ -165,5 +166,32 @@ namespace HWDG
 		}
 		return Path(nodes, pathweight, exists);
 	}
-}
 
+	void Workspace::Clear(void)
+	{
+		this->_cells.clear();
+		this->_queue.clear();
+		this->_lengths.clear();
+	}
+
+	size_t Workspace::size(void) const
+	{
+		return this->_cells.size();
+	}
+
+	Path Workspace::GetPath(const Node& tgt) const
+	{
+		auto iter = this->_cells.find(tgt.id());
+		if (iter == this->_cells.end()) return Path({ tgt }, std::numeric_limits<double>::max(), false);
+		std::vector<Node> nodes;
+		const double weight = iter->second.pathweight;
+		nodes.push_back(tgt);
+		while ((iter->second.prev_id != PathtableCell::NO_PREVIOUS) && (iter->second.prev_id != PathtableCell::STARTING))
+		{
+			nodes.push_back(Node(iter->second.prev_id));
+			iter = this->_cells.find(iter->second.prev_id);
+		}
+		std::reverse(nodes.begin(), nodes.end());
+		return Path(nodes, weight, true);
+	}
+}
@@ -14,6 +14,8 @@
 #include <string>
 #include <cstdint>
 #include <iostream>
+#include <unordered_map>
+#include <utility>
 #include "custom_map.hpp"
 #include "node.hpp"
 #include "edge.hpp"
@@ -214,6 +216,43 @@ namespace HWDG
 			static Path LoadBin(std::istream& file);
 	};
 
+	/**
+	* Reusable memory for local pathfinding queries.
+	*
+	* Local queries (for example Dijkstra::ComputePath() or BFSPathfinding::ComputePath()) create cells only for nodes they actually reach, instead of Pathtable covering whole Graph.
+	* Passing the same Workspace to consecutive queries allows them to reuse memory allocated by previous ones.
+	*
+	* Workspace holds results of the last query only. It's not thread-safe, each thread is supposed to use its' own Workspace.
+	*/
+	class Workspace
+	{
+		friend class Dijkstra;
+		friend class BFSPathfinding;
+		friend class BellmanFord;
+		friend class ViewTraversal;
+		private:
+			std::unordered_map<uint32_t, PathtableCell> _cells;
+			std::vector<std::pair<double, uint32_t>> _queue;
+			std::unordered_map<uint32_t, uint32_t> _lengths;
+			void Clear(void);
+		public:
+			/**
+			* Get Path to target Node, found by the last query that used this Workspace.
+			* \param tgt Target Node, to which Path should be generated.
+			* \return Path leading from source of the last query to target Node. Path doesn't exist if target Node wasn't reached.
+			* \par Time complexity:
+			* \f$O(n)\f$
+			*/
+			Path GetPath(const Node& tgt) const;
+
+			/**
+			* Number of nodes reached by the last query.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size(void) const;
+	};
+
 	/**
 		* Thin wrapper for std::unordered_map. It's pathtable used by Dijkstra and BellmanFord algorithms.
 		* 
@@ -0,0 +1,157 @@
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "random_walk.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	RandomWalk::Random::Random(const uint64_t& seed) : _state(seed) {}
+
+	uint64_t RandomWalk::Random::Next(void)
+	{
+		const uint64_t output = Tools::Mix64(this->_state);
+		this->_state = this->_state + 0x9E3779B97F4A7C15ull;
+		return output;
+	}
+
+	double RandomWalk::Random::Uniform(void)
+	{
+		return (this->Next() >> 11) * 0x1.0p-53;
+	}
+
+	RandomWalk::RandomWalk(const CompactGraph& graph, const double& p, const double& q, ThreadPool& pool) : _offsets(graph.offsets()), _targets(graph.targets()), _p(p), _q(q)
+	{
+		if (!(p > 0) || !(q > 0)) throw std::invalid_argument(Tools::string_format("RandomWalk: parameters p = %f and q = %f must be positive", p, q));
+		const std::vector<float>& weights = graph.weights();
+		for (const float& weight : weights)
+		{
+			if (weight < 0) throw std::invalid_argument(Tools::string_format("RandomWalk: graph has negative weight %f", weight));
+		}
+		this->_table.resize(this->_targets.size());
+
+		// Vose's alias method, independently for every node
+		pool.ParallelFor(0, graph.size_nodes(), 256, [&](size_t first, size_t last) {
+			std::vector<double> scaled;
+			std::vector<uint32_t> small;
+			std::vector<uint32_t> large;
+			for (size_t node = first; node < last; ++node)
+			{
+				const size_t begin = this->_offsets[node];
+				const uint32_t degree = static_cast<uint32_t>(this->_offsets[node + 1] - begin);
+				double total = 0;
+				for (uint32_t j = 0; j < degree; ++j) { total = total + weights[begin + j]; }
+				scaled.resize(degree);
+				small.clear();
+				large.clear();
+				for (uint32_t j = 0; j < degree; ++j)
+				{
+					scaled[j] = (total > 0) ? weights[begin + j] * degree / total : 1.0;
+					if (scaled[j] < 1.0) small.push_back(j);
+					else large.push_back(j);
+				}
+				while (!small.empty() && !large.empty())
+				{
+					const uint32_t l = small.back();
+					const uint32_t g = large.back();
+					small.pop_back();
+					this->_table[begin + l] = { static_cast<float>(scaled[l]), this->_targets[begin + l], this->_targets[begin + g] };
+					scaled[g] = (scaled[g] + scaled[l]) - 1.0;
+					if (scaled[g] < 1.0)
+					{
+						large.pop_back();
+						small.push_back(g);
+					}
+				}
+				// Leftovers are equal to 1, up to rounding errors
+				for (const uint32_t& j : large) { this->_table[begin + j] = { 1.0f, this->_targets[begin + j], this->_targets[begin + j] }; }
+				for (const uint32_t& j : small) { this->_table[begin + j] = { 1.0f, this->_targets[begin + j], this->_targets[begin + j] }; }
+			}
+		});
+	}
+
+	uint32_t RandomWalk::Sample(const uint32_t& node, Random& random) const
+	{
+		const size_t begin = this->_offsets[node];
+		const uint64_t degree = this->_offsets[node + 1] - begin;
+		const uint64_t bits = random.Next();
+		// High half picks the column, low half decides between column and its' alias
+		const uint32_t column = static_cast<uint32_t>(((bits >> 32) * degree) >> 32);
+		const float threshold = static_cast<float>((bits & 0xFFFFFFFFull) * 0x1.0p-32);
+		const Cell& cell = this->_table[begin + column];
+		return (threshold < cell.probability) ? cell.target : cell.alias;
+	}
+
+	bool RandomWalk::Connected(const uint32_t& source, const uint32_t& target) const
+	{
+		const auto first = this->_targets.begin() + this->_offsets[source];
+		const auto last = this->_targets.begin() + this->_offsets[source + 1];
+		return std::binary_search(first, last, target);
+	}
+
+	void RandomWalk::Walk(const uint32_t& start, const size_t& length, const uint64_t& seed, uint32_t* output) const
+	{
+		if (length == 0) return;
+		Random random(seed);
+		const bool biased = (this->_p != 1.0 || this->_q != 1.0);
+		const double back = 1.0 / this->_p;
+		const double away = 1.0 / this->_q;
+		const double ceiling = std::max({ back, away, 1.0 });
+		uint32_t previous = END;
+		uint32_t current = start;
+		output[0] = start;
+		size_t step = 1;
+		for (; step < length; ++step)
+		{
+			if (this->_offsets[current] == this->_offsets[current + 1]) break;
+			uint32_t next = this->Sample(current, random);
+			if (biased && previous != END)
+			{
+				while (true)
+				{
+					const double bias = (next == previous) ? back : (this->Connected(previous, next) ? 1.0 : away);
+					if (random.Uniform() * ceiling < bias) break;
+					next = this->Sample(current, random);
+				}
+			}
+			previous = current;
+			current = next;
+			output[step] = current;
+		}
+		std::fill(output + step, output + length, END);
+	}
+
+	size_t RandomWalk::size_nodes(void) const
+	{
+		return this->_offsets.size() - 1;
+	}
+
+	std::vector<uint32_t> RandomWalk::Walk(const uint32_t& start, const size_t& length, const uint64_t& seed) const
+	{
+		if (start >= this->size_nodes()) throw std::out_of_range(Tools::string_format("RandomWalk: node index %u out of range, graph has %zu nodes", start, this->size_nodes()));
+		std::vector<uint32_t> output(length);
+		this->Walk(start, length, seed, output.data());
+		return output;
+	}
+
+	void RandomWalk::Generate(const size_t& walks_per_node, const size_t& length, const uint64_t& seed, uint32_t* output, ThreadPool& pool) const
+	{
+		const size_t n = this->size_nodes();
+		if (n == 0) return;
+		const uint64_t base = Tools::Mix64(seed);
+		pool.ParallelFor(0, walks_per_node * n, 64, [&](size_t first, size_t last) {
+			for (size_t k = first; k < last; ++k)
+			{
+				this->Walk(static_cast<uint32_t>(k % n), length, base ^ Tools::Mix64(k), output + k * length);
+			}
+		});
+	}
+
+	std::vector<uint32_t> RandomWalk::Generate(const size_t& walks_per_node, const size_t& length, const uint64_t& seed, ThreadPool& pool) const
+	{
+		std::vector<uint32_t> output(walks_per_node * this->size_nodes() * length);
+		this->Generate(walks_per_node, length, seed, output.data(), pool);
+		return output;
+	}
+}
@@ -0,0 +1,126 @@
+#ifndef HWDG_RANDOM_WALK_HPP
+#define HWDG_RANDOM_WALK_HPP
+
+/**
+* @file random_walk.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Weighted random walks and node2vec sampling.
+*
+* This file contains RandomWalk class, which generates random walks over CompactGraph, for example as input of graph embeddings.
+*/
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Engine generating random walks, with probability of following the edge proportional to its' weight.
+	*
+	* Alias table of every node is built once, so every step of first-order walk takes constant time, instead of \f$O(degree)\f$ needed to pick weighted neighbour from hash map.
+	* Second-order (node2vec) walks are biased by return parameter p and in-out parameter q: after coming from node t, step back to t has its' weight divided by p, 
+	* step to successor of t is unchanged, and any other step has weight divided by q. Bias is applied with rejection sampling on top of alias tables, so no per-edge tables of size \f$O(degree^2)\f$ are needed.
+	*
+	* Walks are expressed as indices of nodes, as defined by CompactGraph::index() - use CompactGraph::ids() to translate them back to identifiers.
+	* Weights MUST be non-negative. Nodes whose edges all have weight 0 choose their successor uniformly.
+	*/
+	class RandomWalk
+	{
+		private:
+			// Counter-based splitmix64 generator
+			class Random
+			{
+				private:
+					uint64_t _state;
+				public:
+					Random(const uint64_t& seed);
+					uint64_t Next(void);
+					double Uniform(void);
+			};
+		private:
+			// Column of alias table, both candidates stored together so every step touches single cache line
+			struct Cell
+			{
+				float probability;
+				uint32_t target;
+				uint32_t alias;
+			};
+		private:
+			std::vector<size_t> _offsets;
+			std::vector<uint32_t> _targets;
+			std::vector<Cell> _table;
+			double _p;
+			double _q;
+		private:
+			uint32_t Sample(const uint32_t& node, Random& random) const;
+			bool Connected(const uint32_t& source, const uint32_t& target) const;
+			void Walk(const uint32_t& start, const size_t& length, const uint64_t& seed, uint32_t* output) const;
+		public:
+			/**
+			* Marks end of walk that reached node without successors, all remaining positions of that walk are filled with it.
+			*/
+			static constexpr uint32_t END = std::numeric_limits<uint32_t>::max();
+
+			/**
+			* Build alias tables of the graph.
+			* \param graph Graph in CSR form. 
+			* \param p Return parameter of node2vec. 
+			* \param q In-out parameter of node2vec. Walks are first-order (plain weighted walks) if both parameters are equal to 1.
+			* \param pool ThreadPool building the tables.
+			* \throws std::invalid_argument if graph has negative weights, or p or q isn't positive.
+			* \par Time complexity:
+			* \f$O(\frac{nodes + edges}{threads})\f$
+			*/
+			RandomWalk(const CompactGraph& graph, const double& p = 1.0, const double& q = 1.0, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* \return Number of nodes of the graph.
+			*/
+			size_t size_nodes(void) const;
+
+			/**
+			* Generate single walk.
+			* \param start Index of the first node of walk.
+			* \param length Number of nodes in walk, including start.
+			* \param seed Seed of random number generator. The same seed always gives the same walk.
+			* \return Indices of visited nodes, padded with END if walk reached node without successors.
+			* \throws std::out_of_range if start isn't valid index.
+			* \par Time complexity:
+			* \f$O(length)\f$ expected.
+			*/
+			std::vector<uint32_t> Walk(const uint32_t& start, const size_t& length, const uint64_t& seed) const;
+
+			/**
+			* Generate walks_per_node walks starting at every node, in parallel, directly into contiguous buffer.
+			*
+			* Walk number k (0 <= k < walks_per_node * size_nodes()) starts at node k % size_nodes() and occupies positions [k * length, (k+1) * length) of output.
+			* Every walk has its' own generator, seeded from seed and k, so result doesn't depend on number of threads.
+			* \param walks_per_node Number of walks starting at every node.
+			* \param length Number of nodes in every walk, including start.
+			* \param seed Seed of random number generators.
+			* \param output Buffer of at least walks_per_node * size_nodes() * length elements.
+			* \param pool ThreadPool generating walks.
+			* \par Time complexity:
+			* \f$O(\frac{walks * length}{threads})\f$ expected.
+			*/
+			void Generate(const size_t& walks_per_node, const size_t& length, const uint64_t& seed, uint32_t* output, ThreadPool& pool = ThreadPool::Default()) const;
+
+			/**
+			* Generate walks_per_node walks starting at every node, in parallel. Layout is the same as in Generate(const size_t&, const size_t&, const uint64_t&, uint32_t*, ThreadPool&) const.
+			* \param walks_per_node Number of walks starting at every node.
+			* \param length Number of nodes in every walk, including start.
+			* \param seed Seed of random number generators.
+			* \param pool ThreadPool generating walks.
+			* \return Buffer of walks_per_node * size_nodes() * length indices.
+			* \par Time complexity:
+			* \f$O(\frac{walks * length}{threads})\f$ expected.
+			*/
+			std::vector<uint32_t> Generate(const size_t& walks_per_node, const size_t& length, const uint64_t& seed = 0, ThreadPool& pool = ThreadPool::Default()) const;
+	};
+}
+
+#endif
@@ -0,0 +1,210 @@
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+#include "reachability.hpp"
+#include "compact_graph.hpp"
+#include "components.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		template<typename TYPE>
+		void WriteVector(std::ostream& file, const std::vector<TYPE>& data)
+		{
+			size_t size = data.size();
+			file.write((const char*)&size, sizeof(size));
+			file.write((const char*)data.data(), sizeof(TYPE) * size);
+		}
+
+		template<typename TYPE>
+		std::vector<TYPE> ReadVector(std::istream& file)
+		{
+			size_t size = 0;
+			file.read((char*)&size, sizeof(size));
+			std::vector<TYPE> data(size);
+			file.read((char*)data.data(), sizeof(TYPE) * size);
+			return data;
+		}
+	}
+
+	ReachabilityIndex::ReachabilityIndex(const size_t& dimensions) : _fingerprint(0), _dimensions(dimensions) {}
+
+	ReachabilityIndex::ReachabilityIndex(const Graph& graph, const size_t& dimensions, const uint64_t& seed) : ReachabilityIndex(dimensions)
+	{
+		if (dimensions == 0) throw std::invalid_argument("ReachabilityIndex: at least one dimension is required");
+		this->Build(graph, seed);
+	}
+
+	void ReachabilityIndex::Build(const Graph& graph, const uint64_t& seed)
+	{
+		const CompactGraph compact(graph);
+		const std::vector<uint32_t> labels = Components::StronglyConnected(compact);
+		// Nodes of condensation are labels 0..k-1, so their dense indices are equal to labels
+		const CompactGraph dag(Components::Condensation(compact, labels));
+		const size_t k = dag.size_nodes();
+
+		this->_fingerprint = graph.fingerprint();
+		this->_components.clear();
+		this->_components.reserve(compact.size_nodes());
+		for (uint32_t i = 0; i < compact.size_nodes(); ++i) { this->_components.insert({ compact.ids()[i], labels[i] }); }
+		this->_offsets.assign(dag.offsets().begin(), dag.offsets().end());
+		this->_targets = dag.targets();
+
+		std::vector<uint32_t> in_degree(k, 0);
+		for (const uint32_t& target : this->_targets) { in_degree[target]++; }
+		std::vector<uint32_t> roots;
+		for (uint32_t i = 0; i < k; ++i) { if (in_degree[i] == 0) roots.push_back(i); }
+
+		// Randomised post-order traversals: roots are shuffled, and children of every node are visited starting from random position
+		this->_low.assign(this->_dimensions * k, 0);
+		this->_post.assign(this->_dimensions * k, 0);
+		std::vector<uint8_t> visited(k);
+		std::vector<std::pair<uint32_t, uint32_t>> stack;
+		for (size_t d = 0; d < this->_dimensions; ++d)
+		{
+			uint32_t* low = this->_low.data() + d * k;
+			uint32_t* post = this->_post.data() + d * k;
+			const uint64_t dimension_seed = Tools::Mix64(seed ^ Tools::Mix64(d + 1));
+			std::fill(visited.begin(), visited.end(), 0);
+			for (size_t i = roots.size(); i > 1; --i) { std::swap(roots[i - 1], roots[Tools::Mix64(dimension_seed + i) % i]); }
+			uint32_t rank = 0;
+			for (const uint32_t& root : roots)
+			{
+				visited[root] = 1;
+				stack.push_back({ root, 0 });
+				while (stack.size())
+				{
+					const uint32_t current = stack.back().first;
+					const uint32_t degree = this->_offsets[current + 1] - this->_offsets[current];
+					if (stack.back().second < degree)
+					{
+						const uint32_t rotation = (uint32_t)(Tools::Mix64(dimension_seed ^ current) % degree);
+						const uint32_t child = this->_targets[this->_offsets[current] + (stack.back().second + rotation) % degree];
+						stack.back().second++;
+						if (visited[child]) continue;
+						visited[child] = 1;
+						stack.push_back({ child, 0 });
+						continue;
+					}
+					stack.pop_back();
+					post[current] = ++rank;
+					low[current] = rank;
+					for (uint32_t e = this->_offsets[current]; e < this->_offsets[current + 1]; ++e)
+					{
+						low[current] = std::min(low[current], low[this->_targets[e]]);
+					}
+				}
+			}
+		}
+	}
+
+	bool ReachabilityIndex::Contains(const uint32_t& outer, const uint32_t& inner) const
+	{
+		const size_t k = this->size_components();
+		for (size_t d = 0; d < this->_dimensions; ++d)
+		{
+			if (this->_low[d * k + inner] < this->_low[d * k + outer]) return false;
+			if (this->_post[d * k + inner] > this->_post[d * k + outer]) return false;
+		}
+		return true;
+	}
+
+	uint32_t ReachabilityIndex::Component(const Node& node) const
+	{
+		auto iter = this->_components.find(node.id());
+		if (iter == this->_components.end()) throw std::out_of_range(Tools::string_format("Node %s doesn't belong to indexed graph", node.str().c_str()));
+		return iter->second;
+	}
+
+	bool ReachabilityIndex::Reachable(const Node& src, const Node& tgt) const
+	{
+		const uint32_t source = this->Component(src);
+		const uint32_t target = this->Component(tgt);
+		if (source == target) return true;
+		if (!this->Contains(source, target)) return false;
+		// Pruned DFS: only components whose intervals contain intervals of target can lead to it
+		std::unordered_set<uint32_t> visited;
+		std::vector<uint32_t> stack;
+		stack.push_back(source);
+		visited.insert(source);
+		while (stack.size())
+		{
+			const uint32_t current = stack.back();
+			stack.pop_back();
+			for (uint32_t e = this->_offsets[current]; e < this->_offsets[current + 1]; ++e)
+			{
+				const uint32_t child = this->_targets[e];
+				if (child == target) return true;
+				if (visited.count(child) || !this->Contains(child, target)) continue;
+				visited.insert(child);
+				stack.push_back(child);
+			}
+		}
+		return false;
+	}
+
+	bool ReachabilityIndex::Valid(const Graph& graph) const
+	{
+		return graph.fingerprint() == this->_fingerprint && graph.size_nodes() == this->_components.size();
+	}
+
+	bool ReachabilityIndex::Refresh(const Graph& graph, const uint64_t& seed)
+	{
+		if (this->Valid(graph)) return false;
+		this->Build(graph, seed);
+		return true;
+	}
+
+	size_t ReachabilityIndex::size_components(void) const
+	{
+		return this->_offsets.size() - 1;
+	}
+
+	size_t ReachabilityIndex::memory(void) const
+	{
+		// Hash map: node of the list (key, value and pointer) plus bucket, per element
+		const size_t map = this->_components.size() * (sizeof(std::pair<const uint32_t, uint32_t>) + 2 * sizeof(void*)) + this->_components.bucket_count() * sizeof(void*);
+		const size_t arrays = sizeof(uint32_t) * (this->_offsets.capacity() + this->_targets.capacity() + this->_low.capacity() + this->_post.capacity());
+		return sizeof(ReachabilityIndex) + map + arrays;
+	}
+
+	void ReachabilityIndex::SaveBin(std::ostream& file, const ReachabilityIndex& index)
+	{
+		file.write((const char*)&index._fingerprint, sizeof(index._fingerprint));
+		file.write((const char*)&index._dimensions, sizeof(index._dimensions));
+		std::vector<uint32_t> components;
+		components.reserve(2 * index._components.size());
+		for (const auto& pair : index._components)
+		{
+			components.push_back(pair.first);
+			components.push_back(pair.second);
+		}
+		WriteVector(file, components);
+		WriteVector(file, index._offsets);
+		WriteVector(file, index._targets);
+		WriteVector(file, index._low);
+		WriteVector(file, index._post);
+	}
+
+	ReachabilityIndex ReachabilityIndex::LoadBin(std::istream& file)
+	{
+		uint64_t fingerprint = 0;
+		size_t dimensions = 0;
+		file.read((char*)&fingerprint, sizeof(fingerprint));
+		file.read((char*)&dimensions, sizeof(dimensions));
+		ReachabilityIndex output(dimensions);
+		output._fingerprint = fingerprint;
+		const std::vector<uint32_t> components = ReadVector<uint32_t>(file);
+		output._components.reserve(components.size() / 2);
+		for (size_t i = 0; i + 1 < components.size(); i += 2) { output._components.insert({ components[i], components[i + 1] }); }
+		output._offsets = ReadVector<uint32_t>(file);
+		output._targets = ReadVector<uint32_t>(file);
+		output._low = ReadVector<uint32_t>(file);
+		output._post = ReadVector<uint32_t>(file);
+		return output;
+	}
+}
@@ -0,0 +1,134 @@
+#ifndef HWDG_REACHABILITY_HPP
+#define HWDG_REACHABILITY_HPP
+
+/**
+* @file reachability.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Index answering reachability queries.
+*
+* This file contains ReachabilityIndex class, which answers "can A reach B" without traversing whole Graph.
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "node.hpp"
+#include "graph.hpp"
+
+namespace HWDG
+{
+	/**
+	* Index answering whether one Node can reach another one.
+	*
+	* Index is built over condensation of the Graph (check Components::Condensation()): nodes within the same strongly connected component always reach each other, 
+	* and condensation is directed acyclic graph. Every component gets several interval labels (GRAIL), computed by randomised post-order traversals of condensation.
+	* If A reaches B, interval of B is contained in interval of A for every traversal, so most negative queries are answered in constant time. 
+	* Remaining ones are answered with DFS over condensation, that skips every component whose intervals don't contain intervals of B.
+	*
+	* Index isn't updated when Graph changes. Use ReachabilityIndex::Valid() to check whether it still describes the Graph, and ReachabilityIndex::Refresh() to rebuild it.
+	* Queries don't modify index, so they can be run from many threads at the same time.
+	*/
+	class ReachabilityIndex
+	{
+		private:
+			uint64_t _fingerprint;
+			size_t _dimensions;
+			std::unordered_map<uint32_t, uint32_t> _components;
+			std::vector<uint32_t> _offsets;
+			std::vector<uint32_t> _targets;
+			std::vector<uint32_t> _low;
+			std::vector<uint32_t> _post;
+		private:
+			ReachabilityIndex(const size_t& dimensions);
+			void Build(const Graph& graph, const uint64_t& seed);
+			bool Contains(const uint32_t& outer, const uint32_t& inner) const;
+			uint32_t Component(const Node& node) const;
+		public:
+			/**
+			* Default number of interval labels per component.
+			*/
+			static constexpr size_t DEFAULT_DIMENSIONS = 4;
+
+			/**
+			* Index must be built from Graph, so default constructor is removed.
+			*/
+			ReachabilityIndex() = delete;
+
+			/**
+			* Build index of the Graph.
+			* \param graph Indexed Graph.
+			* \param dimensions Number of interval labels per component. More labels answer more queries in constant time, but take more memory.
+			* \param seed Seed of randomised traversals.
+			* \throws std::invalid_argument if dimensions is 0.
+			* \par Time complexity:
+			* \f$O(nodes + dimensions * edges)\f$
+			*/
+			ReachabilityIndex(const Graph& graph, const size_t& dimensions = DEFAULT_DIMENSIONS, const uint64_t& seed = 0);
+
+			/**
+			* Check whether Node tgt can be reached from Node src. Every Node reaches itself.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \return true if there's path from src to tgt.
+			* \throws std::out_of_range if any of nodes wasn't part of indexed Graph.
+			* \par Time complexity:
+			* \f$O(dimensions)\f$ for most queries, \f$O(components + edges)\f$ of condensation in the worst case.
+			*/
+			bool Reachable(const Node& src, const Node& tgt) const;
+
+			/**
+			* Check whether index still describes given Graph, by comparing Graph::fingerprint()
+			* \param graph Graph to be checked.
+			* \return true if graph has the same nodes and edges as Graph the index was built from.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			bool Valid(const Graph& graph) const;
+
+			/**
+			* Rebuild index if it doesn't describe given Graph anymore.
+			* \param graph Indexed Graph.
+			* \param seed Seed of randomised traversals.
+			* \return true if index was rebuilt.
+			* \par Time complexity:
+			* \f$O(1)\f$ if index is valid, otherwise the same as building new one.
+			*/
+			bool Refresh(const Graph& graph, const uint64_t& seed = 0);
+
+			/**
+			* Get number of strongly connected components of indexed Graph.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_components(void) const;
+
+			/**
+			* Get approximate memory used by index, in bytes.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t memory(void) const;
+
+			/**
+			* Save to stream - binary form.
+			* \param file Reference to ostream-like object, opened in binary mode.
+			* \param index ReachabilityIndex to be saved.
+			* \par Time complexity:
+			* \f$O(nodes + dimensions * components + edges)\f$ of condensation.
+			*/
+			static void SaveBin(std::ostream& file, const ReachabilityIndex& index);
+
+			/**
+			* Load from stream - binary form.
+			* \param file Reference to istream-like object, opened in binary mode.
+			* \return ReachabilityIndex loaded from stream.
+			* \par Time complexity:
+			* \f$O(nodes + dimensions * components + edges)\f$ of condensation.
+			*/
+			static ReachabilityIndex LoadBin(std::istream& file);
+	};
+}
+
+#endif
@@ -0,0 +1,91 @@
+
+#include <algorithm>
+#include <vector>
+#include "similarity.hpp"
+#include "edge.hpp"
+
+namespace HWDG
+{
+	Similarity::Matrix::Matrix(const size_t& rows, const size_t& cols) : _rows(rows), _cols(cols), _data(rows * cols, 0) {}
+
+	size_t Similarity::Matrix::rows(void) const
+	{
+		return this->_rows;
+	}
+
+	size_t Similarity::Matrix::cols(void) const
+	{
+		return this->_cols;
+	}
+
+	double& Similarity::Matrix::operator () (const size_t& row, const size_t& col)
+	{
+		return this->_data[row * this->_cols + col];
+	}
+
+	const double& Similarity::Matrix::operator () (const size_t& row, const size_t& col) const
+	{
+		return this->_data[row * this->_cols + col];
+	}
+
+	double Similarity::Compare(const Graph& a, const Graph& b, const Metric& metric)
+	{
+		const double size_a = a.size_edges();
+		const double size_b = b.size_edges();
+		const double size_similarity = std::min(size_a, size_b) / std::max(size_a, size_b);
+		if (metric == Metric::Size) return size_similarity;
+		// Single pass over edges of smaller graph, probing the bigger one
+		const Graph& smaller = (a.size_edges() < b.size_edges()) ? a : b;
+		const Graph& bigger = (a.size_edges() < b.size_edges()) ? b : a;
+		double common_edges = 0;
+		double value = 0;
+		for (const Edge& edge : smaller.edges())
+		{
+			auto iter = bigger.get_edge(edge);
+			if (iter == bigger.edges().cend()) continue;
+			common_edges = common_edges + 1;
+			if (metric == Metric::Containment) continue;
+			const double weight_a = edge.weight();
+			const double weight_b = (*iter).weight();
+			value = value + std::min(weight_a, weight_b) / std::max(weight_a, weight_b);
+		}
+		switch (metric)
+		{
+			case Metric::Containment: return common_edges / std::min(size_a, size_b);
+			case Metric::Value: return value / std::max(size_a, size_b);
+			case Metric::NormalizedValue: return (value / std::max(size_a, size_b)) / size_similarity;
+			case Metric::Size: break;
+		}
+		return size_similarity;
+	}
+
+	Similarity::Matrix Similarity::AllPairs(const std::vector<Graph>& corpus, const Metric& metric, ThreadPool& pool)
+	{
+		Matrix output(corpus.size(), corpus.size());
+		// Rows have different length (upper triangle only), so every row is separate task
+		pool.ParallelFor(0, corpus.size(), 1, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i)
+			{
+				for (size_t j = i; j < corpus.size(); ++j)
+				{
+					const double similarity = Similarity::Compare(corpus[i], corpus[j], metric);
+					output(i, j) = similarity;
+					output(j, i) = similarity;
+				}
+			}
+		});
+		return output;
+	}
+
+	std::vector<double> Similarity::OneVsMany(const Graph& graph, const std::vector<Graph>& corpus, const Metric& metric, ThreadPool& pool)
+	{
+		std::vector<double> output(corpus.size(), 0);
+		pool.ParallelFor(0, corpus.size(), 1, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i)
+			{
+				output[i] = Similarity::Compare(graph, corpus[i], metric);
+			}
+		});
+		return output;
+	}
+}
@@ -0,0 +1,122 @@
+#ifndef HWDG_SIMILARITY_HPP
+#define HWDG_SIMILARITY_HPP
+
+/**
+* @file similarity.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Batched similarity of many graphs.
+*
+* This file contains Similarity class, which compares whole corpus of graphs in parallel.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class computing similarity between many graphs at once.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* Metrics are the same as Operations::ContainmentSimilarity(), Operations::SizeSimilarity(), Operations::ValueSimilarity() and Operations::NormalizedValueSimilarity().
+	* All of them are computed from single pass over edges of the smaller Graph of the pair, without building any intermediate Graph.
+	* Values can differ from Operations in the last bits, because weights are summed in different order.
+	*/
+	class Similarity
+	{
+		public:
+			/**
+			* Similarity metric.
+			*/
+			enum class Metric
+			{
+				//! Operations::ContainmentSimilarity()
+				Containment,
+				//! Operations::SizeSimilarity()
+				Size,
+				//! Operations::ValueSimilarity()
+				Value,
+				//! Operations::NormalizedValueSimilarity()
+				NormalizedValue
+			};
+
+			/**
+			* Dense matrix of similarities, stored row after row in single contiguous buffer.
+			*/
+			class Matrix
+			{
+				private:
+					size_t _rows;
+					size_t _cols;
+					std::vector<double> _data;
+				public:
+					/**
+					* Create matrix filled with zeros.
+					* \param rows Number of rows.
+					* \param cols Number of columns.
+					*/
+					Matrix(const size_t& rows, const size_t& cols);
+					/**
+					* Get number of rows.
+					* \par Time complexity:
+					* \f$O(1)\f$
+					*/
+					size_t rows(void) const;
+					/**
+					* Get number of columns.
+					* \par Time complexity:
+					* \f$O(1)\f$
+					*/
+					size_t cols(void) const;
+					/**
+					* Access cell of the matrix.
+					* \param row Row index, must belong to [0,rows()-1]
+					* \param col Column index, must belong to [0,cols()-1]
+					* \par Time complexity:
+					* \f$O(1)\f$
+					*/
+					double& operator () (const size_t& row, const size_t& col);
+					/**
+					* Read cell of the matrix.
+					* \param row Row index, must belong to [0,rows()-1]
+					* \param col Column index, must belong to [0,cols()-1]
+					* \par Time complexity:
+					* \f$O(1)\f$
+					*/
+					const double& operator () (const size_t& row, const size_t& col) const;
+			};
+		private:
+			static double Compare(const Graph& a, const Graph& b, const Metric& metric);
+		public:
+			Similarity() = delete;
+
+			/**
+			* Compare every pair of graphs within corpus.
+			* All metrics are symmetric, so only half of the pairs is actually computed. Rows are processed in parallel.
+			* \param corpus List of graphs.
+			* \param metric Similarity metric.
+			* \param pool ThreadPool executing the comparison.
+			* \return Square matrix, cell (i,j) holds similarity between corpus[i] and corpus[j].
+			* \par Time complexity:
+			* \f$O(\frac{graphs^2 * edges}{threads})\f$
+			*/
+			static Matrix AllPairs(const std::vector<Graph>& corpus, const Metric& metric, ThreadPool& pool = ThreadPool::Default());
+
+			/**
+			* Compare single Graph against every graph within corpus.
+			* \param graph Graph to be compared.
+			* \param corpus List of graphs.
+			* \param metric Similarity metric.
+			* \param pool ThreadPool executing the comparison.
+			* \return List of similarities, i-th value is similarity between graph and corpus[i].
+			* \par Time complexity:
+			* \f$O(\frac{graphs * edges}{threads})\f$
+			*/
+			static std::vector<double> OneVsMany(const Graph& graph, const std::vector<Graph>& corpus, const Metric& metric, ThreadPool& pool = ThreadPool::Default());
+	};
+}
+
+#endif
@@ -0,0 +1,257 @@
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+#include "sketch.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	GraphSketch::GraphSketch(const uint64_t& seed, const size_t& edges, const std::vector<uint64_t>& hashes, const std::vector<float>& weights)
+		: _seed(seed), _edges(edges), _hashes(hashes), _weights(weights) {}
+
+	GraphSketch::GraphSketch(const Graph& graph, const size_t& size, const uint64_t& seed)
+		: _seed(seed), _edges(graph.size_edges()), _hashes(size, std::numeric_limits<uint64_t>::max()), _weights(size, 0)
+	{
+		std::vector<uint64_t> seeds(size);
+		for (size_t i = 0; i < size; ++i) { seeds[i] = Tools::Mix64(seed + i + 1); }
+		for (const Edge& edge : graph.edges())
+		{
+			const uint64_t id = edge.id();
+			for (size_t i = 0; i < size; ++i)
+			{
+				const uint64_t hash = Tools::Mix64(id ^ seeds[i]);
+				if (hash < this->_hashes[i])
+				{
+					this->_hashes[i] = hash;
+					this->_weights[i] = edge.weight();
+				}
+			}
+		}
+	}
+
+	size_t GraphSketch::size(void) const
+	{
+		return this->_hashes.size();
+	}
+
+	size_t GraphSketch::size_edges(void) const
+	{
+		return this->_edges;
+	}
+
+	uint64_t GraphSketch::seed(void) const
+	{
+		return this->_seed;
+	}
+
+	const std::vector<uint64_t>& GraphSketch::hashes(void) const
+	{
+		return this->_hashes;
+	}
+
+	void GraphSketch::Check(const GraphSketch& a, const GraphSketch& b)
+	{
+		if (a.size() != b.size() || a.seed() != b.seed()) throw std::invalid_argument("GraphSketch: sketches with different size or seed can't be compared");
+	}
+
+	double GraphSketch::Jaccard(const GraphSketch& a, const GraphSketch& b)
+	{
+		GraphSketch::Check(a, b);
+		if (a.size_edges() == 0 || b.size_edges() == 0 || a.size() == 0) return 0;
+		double matches = 0;
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (a._hashes[i] == b._hashes[i]) matches = matches + 1;
+		}
+		return matches / a.size();
+	}
+
+	// |A u B| = |A n B| + |A \ B| + |B \ A|, and |A n B| = J * |A u B|  ->  |A u B| = (|A| + |B|) / (1 + J)
+	double GraphSketch::Union(const GraphSketch& a, const GraphSketch& b, const double& jaccard)
+	{
+		return ((double)a.size_edges() + (double)b.size_edges()) / (1 + jaccard);
+	}
+
+	double GraphSketch::ContainmentSimilarity(const GraphSketch& a, const GraphSketch& b)
+	{
+		const double jaccard = GraphSketch::Jaccard(a, b);
+		const double common_edges = jaccard * GraphSketch::Union(a, b, jaccard);
+		return std::min(1.0, common_edges / std::min(a.size_edges(), b.size_edges()));
+	}
+
+	double GraphSketch::ValueSimilarity(const GraphSketch& a, const GraphSketch& b)
+	{
+		const double jaccard = GraphSketch::Jaccard(a, b);
+		if (jaccard == 0) return 0;
+		// Matching slot samples uniformly edge from union that is common to both graphs, so mean ratio over all slots estimates sum of ratios divided by |A u B|
+		double ratios = 0;
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (a._hashes[i] != b._hashes[i]) continue;
+			const double weight_a = a._weights[i];
+			const double weight_b = b._weights[i];
+			ratios = ratios + std::min(weight_a, weight_b) / std::max(weight_a, weight_b);
+		}
+		ratios = ratios / a.size();
+		return std::min(1.0, ratios * GraphSketch::Union(a, b, jaccard) / std::max(a.size_edges(), b.size_edges()));
+	}
+
+	double GraphSketch::Estimate(const GraphSketch& a, const GraphSketch& b, const Similarity::Metric& metric)
+	{
+		GraphSketch::Check(a, b);
+		const double size_a = a.size_edges();
+		const double size_b = b.size_edges();
+		const double size_similarity = std::min(size_a, size_b) / std::max(size_a, size_b);
+		switch (metric)
+		{
+			case Similarity::Metric::Containment: return GraphSketch::ContainmentSimilarity(a, b);
+			case Similarity::Metric::Value: return GraphSketch::ValueSimilarity(a, b);
+			case Similarity::Metric::NormalizedValue: return GraphSketch::ValueSimilarity(a, b) / size_similarity;
+			case Similarity::Metric::Size: break;
+		}
+		return size_similarity;
+	}
+
+	void GraphSketch::SaveBin(std::ostream& file, const GraphSketch& sketch)
+	{
+		file.write((const char*)&sketch._seed, sizeof(sketch._seed));
+		file.write((const char*)&sketch._edges, sizeof(sketch._edges));
+		size_t size = sketch.size();
+		file.write((const char*)&size, sizeof(size));
+		file.write((const char*)sketch._hashes.data(), sizeof(uint64_t) * size);
+		file.write((const char*)sketch._weights.data(), sizeof(float) * size);
+	}
+
+	GraphSketch GraphSketch::LoadBin(std::istream& file)
+	{
+		uint64_t seed = 0;
+		size_t edges = 0;
+		size_t size = 0;
+		file.read((char*)&seed, sizeof(seed));
+		file.read((char*)&edges, sizeof(edges));
+		file.read((char*)&size, sizeof(size));
+		std::vector<uint64_t> hashes(size);
+		std::vector<float> weights(size);
+		file.read((char*)hashes.data(), sizeof(uint64_t) * size);
+		file.read((char*)weights.data(), sizeof(float) * size);
+		return GraphSketch(seed, edges, hashes, weights);
+	}
+
+	void GraphSketch::SaveTxt(std::ostream& file, const GraphSketch& sketch)
+	{
+		file << sketch._seed << ' ' << sketch._edges << ' ' << sketch.size() << std::endl;
+		for (size_t i = 0; i < sketch.size(); ++i)
+		{
+			file << sketch._hashes[i] << ' ' << sketch._weights[i] << std::endl;
+		}
+	}
+
+	GraphSketch GraphSketch::LoadTxt(std::istream& file)
+	{
+		uint64_t seed = 0;
+		size_t edges = 0;
+		size_t size = 0;
+		file >> seed >> edges >> size;
+		std::vector<uint64_t> hashes(size);
+		std::vector<float> weights(size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			file >> hashes[i] >> weights[i];
+		}
+		return GraphSketch(seed, edges, hashes, weights);
+	}
+
+	SketchIndex::SketchIndex(const size_t& bands, const size_t& rows) : _bands(bands), _rows(rows), _buckets(bands) {}
+
+	uint64_t SketchIndex::Key(const GraphSketch& sketch, const size_t& band) const
+	{
+		uint64_t key = band;
+		for (size_t i = band * this->_rows; i < (band + 1) * this->_rows; ++i)
+		{
+			key = (key ^ sketch.hashes()[i]) * 0x100000001B3ull;
+		}
+		return key;
+	}
+
+	size_t SketchIndex::add(const GraphSketch& sketch)
+	{
+		if (sketch.size() < this->_bands * this->_rows) throw std::invalid_argument(Tools::string_format("SketchIndex: sketch has %zu hashes, index requires %zu", sketch.size(), this->_bands * this->_rows));
+		if (this->_sketches.size() && this->_sketches.front().seed() != sketch.seed()) throw std::invalid_argument("SketchIndex: sketch has different seed than indexed ones");
+		const size_t id = this->_sketches.size();
+		this->_sketches.push_back(sketch);
+		for (size_t band = 0; band < this->_bands; ++band)
+		{
+			this->_buckets[band][this->Key(sketch, band)].push_back(id);
+		}
+		return id;
+	}
+
+	size_t SketchIndex::size(void) const
+	{
+		return this->_sketches.size();
+	}
+
+	const GraphSketch& SketchIndex::at(const size_t& id) const
+	{
+		return this->_sketches.at(id);
+	}
+
+	std::vector<size_t> SketchIndex::Candidates(const GraphSketch& query, const size_t& count, const Similarity::Metric& metric) const
+	{
+		if (query.size() < this->_bands * this->_rows) throw std::invalid_argument("SketchIndex: query sketch is too small for this index");
+		std::unordered_set<size_t> found;
+		for (size_t band = 0; band < this->_bands; ++band)
+		{
+			auto iter = this->_buckets[band].find(this->Key(query, band));
+			if (iter == this->_buckets[band].end()) continue;
+			found.insert(iter->second.begin(), iter->second.end());
+		}
+		std::vector<std::pair<double, size_t>> ranked;
+		ranked.reserve(found.size());
+		for (const size_t& id : found)
+		{
+			ranked.push_back({ GraphSketch::Estimate(query, this->_sketches[id], metric), id });
+		}
+		const size_t output_size = std::min(count, ranked.size());
+		std::partial_sort(ranked.begin(), ranked.begin() + output_size, ranked.end(), [](const auto& l, const auto& r) {
+			if (l.first != r.first) return l.first > r.first;
+			return l.second < r.second;
+		});
+		std::vector<size_t> output;
+		output.reserve(output_size);
+		for (size_t i = 0; i < output_size; ++i) { output.push_back(ranked[i].second); }
+		return output;
+	}
+
+	void SketchIndex::SaveBin(std::ostream& file, const SketchIndex& index)
+	{
+		file.write((const char*)&index._bands, sizeof(index._bands));
+		file.write((const char*)&index._rows, sizeof(index._rows));
+		size_t size = index.size();
+		file.write((const char*)&size, sizeof(size));
+		for (const GraphSketch& sketch : index._sketches)
+		{
+			GraphSketch::SaveBin(file, sketch);
+		}
+	}
+
+	SketchIndex SketchIndex::LoadBin(std::istream& file)
+	{
+		size_t bands = 0;
+		size_t rows = 0;
+		size_t size = 0;
+		file.read((char*)&bands, sizeof(bands));
+		file.read((char*)&rows, sizeof(rows));
+		file.read((char*)&size, sizeof(size));
+		SketchIndex output(bands, rows);
+		output._sketches.reserve(size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			output.add(GraphSketch::LoadBin(file));
+		}
+		return output;
+	}
+}
@@ -0,0 +1,262 @@
+#ifndef HWDG_SKETCH_HPP
+#define HWDG_SKETCH_HPP
+
+/**
+* @file sketch.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief MinHash sketches for approximate graph similarity.
+*
+* This file contains GraphSketch class (MinHash signature of set of edges) and SketchIndex class (LSH index over sketches).
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "edge.hpp"
+#include "graph.hpp"
+#include "similarity.hpp"
+
+namespace HWDG
+{
+	/**
+	* MinHash signature of set of edges of a Graph.
+	*
+	* For each of size() hash functions, sketch stores minimal hash of Edge::id() over all edges of the Graph, together with weight of the Edge that produced this minimum.
+	* Probability that two sketches hold the same minimum in given slot equals Jaccard index of their edge sets, and that edge is uniformly sampled from edges common to both graphs.
+	* This allows to estimate all metrics of Similarity (and Operations) with error roughly \f$\frac{1}{\sqrt{size}}\f$, in time independent of size of graphs.
+	*
+	* Only sketches created with the same size and seed can be compared.
+	*/
+	class GraphSketch
+	{
+		private:
+			uint64_t _seed;
+			size_t _edges;
+			std::vector<uint64_t> _hashes;
+			std::vector<float> _weights;
+		private:
+			GraphSketch(const uint64_t& seed, const size_t& edges, const std::vector<uint64_t>& hashes, const std::vector<float>& weights);
+			static void Check(const GraphSketch& a, const GraphSketch& b);
+			static double Union(const GraphSketch& a, const GraphSketch& b, const double& jaccard);
+		public:
+			/**
+			* Default number of hash functions.
+			*/
+			static constexpr size_t DEFAULT_SIZE = 128;
+
+			/**
+			* Sketch must be created from Graph, so default constructor is removed.
+			*/
+			GraphSketch() = delete;
+
+			/**
+			* Create sketch of the Graph.
+			* \param graph Graph to be sketched.
+			* \param size Number of hash functions. Higher is more accurate, but slower and bigger.
+			* \param seed Seed of hash functions.
+			* \par Time complexity:
+			* \f$O(edges * size)\f$
+			*/
+			GraphSketch(const Graph& graph, const size_t& size = DEFAULT_SIZE, const uint64_t& seed = 0);
+
+			/**
+			* Get number of hash functions.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size(void) const;
+
+			/**
+			* Get number of edges of sketched Graph.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_edges(void) const;
+
+			/**
+			* Get seed of hash functions.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			uint64_t seed(void) const;
+
+			/**
+			* Get minimal hashes, one per hash function.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<uint64_t>& hashes(void) const;
+
+			/**
+			* Estimate Jaccard index of sets of edges: \f$ J(A,B) = \frac{|A \cap B|}{|A \cup B|} \f$
+			* \param a Sketch of Graph A
+			* \param b Sketch of Graph B
+			* \return Estimated Jaccard index, belongs to [0,1]
+			* \throws std::invalid_argument if sketches have different size or seed.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static double Jaccard(const GraphSketch& a, const GraphSketch& b);
+
+			/**
+			* Estimate Operations::ContainmentSimilarity()
+			* \param a Sketch of Graph A
+			* \param b Sketch of Graph B
+			* \return Estimated CS, belongs to [0,1]
+			* \throws std::invalid_argument if sketches have different size or seed.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static double ContainmentSimilarity(const GraphSketch& a, const GraphSketch& b);
+
+			/**
+			* Estimate Operations::ValueSimilarity()
+			* \param a Sketch of Graph A
+			* \param b Sketch of Graph B
+			* \return Estimated VS, belongs to [0,1]
+			* \throws std::invalid_argument if sketches have different size or seed.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static double ValueSimilarity(const GraphSketch& a, const GraphSketch& b);
+
+			/**
+			* Estimate chosen metric of Similarity. Similarity::Metric::Size is exact, because sketch knows number of edges.
+			* \param a Sketch of Graph A
+			* \param b Sketch of Graph B
+			* \param metric Similarity metric.
+			* \return Estimated similarity.
+			* \throws std::invalid_argument if sketches have different size or seed.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static double Estimate(const GraphSketch& a, const GraphSketch& b, const Similarity::Metric& metric);
+
+			/**
+			* Save to stream - binary form.
+			* \param file Reference to ostream-like object, opened in binary mode.
+			* \param sketch GraphSketch to be saved.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static void SaveBin(std::ostream& file, const GraphSketch& sketch);
+
+			/**
+			* Load from stream - binary form.
+			* \param file Reference to istream-like object, opened in binary mode.
+			* \return GraphSketch loaded from stream.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static GraphSketch LoadBin(std::istream& file);
+
+			/**
+			* Save to stream - text form.
+			* \param file Reference to ostream-like object.
+			* \param sketch GraphSketch to be saved.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static void SaveTxt(std::ostream& file, const GraphSketch& sketch);
+
+			/**
+			* Load from stream - text form.
+			* \param file Reference to istream-like object.
+			* \return GraphSketch loaded from stream.
+			* \par Time complexity:
+			* \f$O(size)\f$
+			*/
+			static GraphSketch LoadTxt(std::istream& file);
+	};
+
+	/**
+	* Locality-sensitive hashing (LSH) index of sketches.
+	*
+	* Sketch is cut into bands of rows hashes each. Two sketches land in the same bucket of a band if all hashes within that band are equal,
+	* so graphs with Jaccard index J become candidates with probability \f$1 - (1 - J^{rows})^{bands}\f$.
+	* Candidates are meant to be verified with exact comparison (for example Operations::ContainmentSimilarity()).
+	*/
+	class SketchIndex
+	{
+		private:
+			size_t _bands;
+			size_t _rows;
+			std::vector<GraphSketch> _sketches;
+			std::vector<std::unordered_map<uint64_t, std::vector<size_t>>> _buckets;
+		private:
+			uint64_t Key(const GraphSketch& sketch, const size_t& band) const;
+		public:
+			/**
+			* Index cannot be created without parameters, so default constructor is removed.
+			*/
+			SketchIndex() = delete;
+
+			/**
+			* Create empty index.
+			* \param bands Number of bands.
+			* \param rows Number of hashes per band. bands*rows can't exceed size of indexed sketches.
+			*/
+			SketchIndex(const size_t& bands, const size_t& rows);
+
+			/**
+			* Add sketch to the index.
+			* \param sketch Sketch to be added.
+			* \return Identifier of the sketch within index, equal to number of sketches added before.
+			* \throws std::invalid_argument if sketch is smaller than bands*rows, or has different seed than sketches added before.
+			* \par Time complexity:
+			* \f$O(bands * rows)\f$
+			*/
+			size_t add(const GraphSketch& sketch);
+
+			/**
+			* Get number of sketches within index.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size(void) const;
+
+			/**
+			* Get sketch by its' identifier.
+			* \param id Identifier returned by SketchIndex::add()
+			* \throws std::out_of_range if there's no such sketch.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const GraphSketch& at(const size_t& id) const;
+
+			/**
+			* Find candidates for the most similar graphs.
+			* Sketches sharing at least one bucket with query are ranked by estimated similarity, best ones are returned.
+			* \param query Sketch of Graph you search neighbours for.
+			* \param count Maximal number of candidates.
+			* \param metric Metric used to rank candidates.
+			* \return Identifiers of candidates, the most similar first.
+			* \throws std::invalid_argument if query can't be compared with indexed sketches.
+			* \par Time complexity:
+			* \f$O(bands * rows + candidates * size)\f$
+			*/
+			std::vector<size_t> Candidates(const GraphSketch& query, const size_t& count, const Similarity::Metric& metric = Similarity::Metric::Containment) const;
+
+			/**
+			* Save to stream - binary form. Buckets aren't saved, they're rebuilt during loading.
+			* \param file Reference to ostream-like object, opened in binary mode.
+			* \param index SketchIndex to be saved.
+			* \par Time complexity:
+			* \f$O(sketches * size)\f$
+			*/
+			static void SaveBin(std::ostream& file, const SketchIndex& index);
+
+			/**
+			* Load from stream - binary form.
+			* \param file Reference to istream-like object, opened in binary mode.
+			* \return SketchIndex loaded from stream.
+			* \par Time complexity:
+			* \f$O(sketches * size)\f$
+			*/
+			static SketchIndex LoadBin(std::istream& file);
+	};
+}
+
+#endif
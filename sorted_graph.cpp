@@ -0,0 +1,69 @@
+
+#include <algorithm>
+#include <vector>
+#include "sorted_graph.hpp"
+
+namespace HWDG
+{
+	SortedGraph::SortedGraph(std::vector<uint32_t>&& nodes, std::vector<uint64_t>&& ids, std::vector<Edge>&& edges)
+		: _nodes(std::move(nodes)), _ids(std::move(ids)), _edges(std::move(edges)) {}
+
+	SortedGraph::SortedGraph(const Graph& graph)
+	{
+		this->_nodes.reserve(graph.size_nodes());
+		for (const NodeInGraph& node : graph) { this->_nodes.push_back(node.id()); }
+		std::sort(this->_nodes.begin(), this->_nodes.end());
+
+		std::vector<std::pair<uint64_t, Edge>> edges;
+		edges.reserve(graph.size_edges());
+		for (const Edge& edge : graph.edges()) { edges.push_back({ edge.id(), edge }); }
+		std::sort(edges.begin(), edges.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+		this->_ids.reserve(edges.size());
+		this->_edges.reserve(edges.size());
+		for (const auto& pair : edges)
+		{
+			this->_ids.push_back(pair.first);
+			this->_edges.push_back(pair.second);
+		}
+	}
+
+	Graph SortedGraph::ToGraph(void) const
+	{
+		Graph output;
+		output.reserve_nodes(this->_nodes.size());
+		output.reserve_edges(this->_edges.size());
+		for (const uint32_t& id : this->_nodes) { output.add(Node(id)); }
+		for (const Edge& edge : this->_edges) { output.add(edge); }
+		return output;
+	}
+
+	size_t SortedGraph::size_nodes(void) const
+	{
+		return this->_nodes.size();
+	}
+
+	size_t SortedGraph::size_edges(void) const
+	{
+		return this->_edges.size();
+	}
+
+	const std::vector<uint32_t>& SortedGraph::nodes(void) const
+	{
+		return this->_nodes;
+	}
+
+	const std::vector<Edge>& SortedGraph::edges(void) const
+	{
+		return this->_edges;
+	}
+
+	bool SortedGraph::has(const Node& node) const
+	{
+		return std::binary_search(this->_nodes.begin(), this->_nodes.end(), node.id());
+	}
+
+	bool SortedGraph::has(const Edge& edge) const
+	{
+		return std::binary_search(this->_ids.begin(), this->_ids.end(), edge.id());
+	}
+}
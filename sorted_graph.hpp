@@ -0,0 +1,107 @@
+#ifndef HWDG_SORTED_GRAPH_HPP
+#define HWDG_SORTED_GRAPH_HPP
+
+/**
+* @file sorted_graph.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Frozen snapshot of Graph, stored as sorted arrays.
+*
+* This file contains SortedGraph class, immutable snapshot of Graph with nodes and edges kept in arrays sorted by identifier.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace HWDG
+{
+	class Operations;
+
+	/**
+	* Immutable snapshot of Graph, with nodes sorted by Node::id() and edges sorted by Edge::id().
+	*
+	* Set operations on two snapshots (Operations::Union(const SortedGraph&, const SortedGraph&) and its' siblings) are linear merges of sorted arrays,
+	* instead of hash probe per edge. That makes them cache-friendly, and worth it when the same graphs take part in many operations (for example, when comparing corpus of graphs).
+	* Results are the same as those of hash-based operations on Graph, including nodes added as endpoints of edges.
+	*/
+	class SortedGraph
+	{
+		friend class Operations;
+		private:
+			std::vector<uint32_t> _nodes;
+			std::vector<uint64_t> _ids;
+			std::vector<Edge> _edges;
+		private:
+			SortedGraph(std::vector<uint32_t>&& nodes, std::vector<uint64_t>&& ids, std::vector<Edge>&& edges);
+		public:
+			/**
+			* Create empty snapshot.
+			*/
+			SortedGraph() = default;
+
+			/**
+			* Create snapshot of the Graph.
+			* \param graph Graph to be frozen.
+			* \par Time complexity:
+			* \f$O(edges * log(edges))\f$
+			*/
+			SortedGraph(const Graph& graph);
+
+			/**
+			* Convert snapshot back to Graph.
+			* \return Graph with the same nodes and edges.
+			* \par Time complexity:
+			* \f$O(edges)\f$
+			*/
+			Graph ToGraph(void) const;
+
+			/**
+			* Get number of nodes.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_nodes(void) const;
+
+			/**
+			* Get number of edges.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size_edges(void) const;
+
+			/**
+			* Get identifiers of nodes, in ascending order.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<uint32_t>& nodes(void) const;
+
+			/**
+			* Get edges, in ascending order of Edge::id().
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			const std::vector<Edge>& edges(void) const;
+
+			/**
+			* Check whether Node belongs to snapshot.
+			* \param node Node to be checked.
+			* \par Time complexity:
+			* \f$O(log(nodes))\f$
+			*/
+			bool has(const Node& node) const;
+
+			/**
+			* Check whether Edge belongs to snapshot. Weight is ignored.
+			* \param edge Edge to be checked.
+			* \par Time complexity:
+			* \f$O(log(edges))\f$
+			*/
+			bool has(const Edge& edge) const;
+	};
+}
+
+#endif
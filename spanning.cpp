@@ -0,0 +1,316 @@
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "spanning.hpp"
+#include "graph_builder.hpp"
+#include "tools.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+		constexpr size_t NO_EDGE = std::numeric_limits<size_t>::max();
+
+		// Skew heap of incoming edges, with lazy addition of constant to all keys in subtree
+		struct SkewHeap
+		{
+			struct Item
+			{
+				double key;
+				double delta;
+				uint32_t source;
+				uint32_t target;
+				size_t edge;
+				uint32_t left;
+				uint32_t right;
+			};
+			std::vector<Item> items;
+			std::vector<uint32_t> spine;
+
+			void Push(const uint32_t& item)
+			{
+				Item& it = this->items[item];
+				it.key = it.key + it.delta;
+				if (it.left != NONE) this->items[it.left].delta = this->items[it.left].delta + it.delta;
+				if (it.right != NONE) this->items[it.right].delta = this->items[it.right].delta + it.delta;
+				it.delta = 0;
+			}
+
+			// Iterative, right spine of skew heap can be as long as the heap
+			uint32_t Merge(uint32_t a, uint32_t b)
+			{
+				this->spine.clear();
+				while (a != NONE && b != NONE)
+				{
+					this->Push(a);
+					this->Push(b);
+					if (this->items[a].key > this->items[b].key) std::swap(a, b);
+					this->spine.push_back(a);
+					a = this->items[a].right;
+				}
+				uint32_t merged = (a == NONE) ? b : a;
+				while (!this->spine.empty())
+				{
+					Item& top = this->items[this->spine.back()];
+					top.right = top.left;
+					top.left = merged;
+					merged = this->spine.back();
+					this->spine.pop_back();
+				}
+				return merged;
+			}
+
+			uint32_t Pop(const uint32_t& root)
+			{
+				this->Push(root);
+				return this->Merge(this->items[root].left, this->items[root].right);
+			}
+		};
+
+		// Disjoint sets with union by size and rollback of unions
+		struct RollbackSets
+		{
+			std::vector<int64_t> parent;
+			std::vector<std::pair<uint32_t, int64_t>> history;
+
+			explicit RollbackSets(const size_t& size) : parent(size, -1) {}
+
+			uint32_t Find(uint32_t node) const
+			{
+				while (this->parent[node] >= 0) { node = static_cast<uint32_t>(this->parent[node]); }
+				return node;
+			}
+
+			bool Join(uint32_t a, uint32_t b)
+			{
+				a = this->Find(a);
+				b = this->Find(b);
+				if (a == b) return false;
+				if (this->parent[a] > this->parent[b]) std::swap(a, b);
+				this->history.push_back({ a, this->parent[a] });
+				this->history.push_back({ b, this->parent[b] });
+				this->parent[a] = this->parent[a] + this->parent[b];
+				this->parent[b] = a;
+				return true;
+			}
+
+			void Rollback(const size_t& time)
+			{
+				while (this->history.size() > time)
+				{
+					this->parent[this->history.back().first] = this->history.back().second;
+					this->history.pop_back();
+				}
+			}
+		};
+
+		struct Contraction
+		{
+			uint32_t node;
+			size_t time;
+			std::vector<uint32_t> edges;
+		};
+	}
+
+	Graph SpanningTree::Arborescence(const CompactGraph& graph, const Node& root)
+	{
+		const uint32_t r = graph.index(root);
+		const size_t n = graph.size_nodes();
+		const std::vector<size_t>& offsets = graph.offsets();
+		const std::vector<uint32_t>& targets = graph.targets();
+		const std::vector<float>& weights = graph.weights();
+
+		// Only nodes reachable from root can be spanned, each of them has incoming edge from another reachable node
+		std::vector<bool> reachable(n, false);
+		std::vector<uint32_t> queue(1, r);
+		reachable[r] = true;
+		for (size_t head = 0; head < queue.size(); ++head)
+		{
+			for (size_t e = offsets[queue[head]]; e < offsets[queue[head] + 1]; ++e)
+			{
+				if (reachable[targets[e]]) continue;
+				reachable[targets[e]] = true;
+				queue.push_back(targets[e]);
+			}
+		}
+
+		SkewHeap heap;
+		std::vector<uint32_t> incoming(n, NONE);
+		for (const uint32_t& source : queue)
+		{
+			for (size_t e = offsets[source]; e < offsets[source + 1]; ++e)
+			{
+				const uint32_t target = targets[e];
+				if (target == source || target == r) continue;
+				heap.items.push_back({ weights[e], 0, source, target, e, NONE, NONE });
+				incoming[target] = heap.Merge(incoming[target], static_cast<uint32_t>(heap.items.size() - 1));
+			}
+		}
+
+		RollbackSets sets(n);
+		std::vector<uint32_t> seen(n, NONE);
+		seen[r] = r;
+		std::vector<uint32_t> path(n);
+		std::vector<uint32_t> chosen(n);
+		std::vector<uint32_t> in(n, NONE);
+		std::vector<Contraction> cycles;
+		for (const uint32_t& start : queue)
+		{
+			uint32_t node = start;
+			size_t length = 0;
+			while (seen[node] == NONE)
+			{
+				// Take the lightest incoming edge, weights of remaining ones become relative to it
+				const uint32_t edge = incoming[node];
+				heap.Push(edge);
+				heap.items[edge].delta = -heap.items[edge].key;
+				incoming[node] = heap.Pop(edge);
+				chosen[length] = edge;
+				path[length++] = node;
+				seen[node] = start;
+				node = sets.Find(heap.items[edge].source);
+				if (seen[node] == start)
+				{
+					// Cycle found, contract it into single node
+					uint32_t merged = NONE;
+					const size_t end = length;
+					const size_t time = sets.history.size();
+					uint32_t member;
+					do
+					{
+						member = path[--length];
+						merged = heap.Merge(merged, incoming[member]);
+					} while (sets.Join(node, member));
+					node = sets.Find(node);
+					incoming[node] = merged;
+					seen[node] = NONE;
+					cycles.push_back({ node, time, std::vector<uint32_t>(chosen.begin() + length, chosen.begin() + end) });
+				}
+			}
+			for (size_t i = 0; i < length; ++i) { in[sets.Find(heap.items[chosen[i]].target)] = chosen[i]; }
+		}
+
+		// Expand cycles, from the last contracted one: every edge of cycle is kept, except the one replaced by edge entering the cycle
+		for (auto cycle = cycles.rbegin(); cycle != cycles.rend(); ++cycle)
+		{
+			sets.Rollback(cycle->time);
+			const uint32_t entering = in[cycle->node];
+			for (const uint32_t& edge : cycle->edges) { in[sets.Find(heap.items[edge].target)] = edge; }
+			in[sets.Find(heap.items[entering].target)] = entering;
+		}
+
+		const std::vector<uint32_t>& ids = graph.ids();
+		Graph output;
+		output.reserve_nodes(queue.size());
+		for (const uint32_t& node : queue) { output.add(Node(ids[node])); }
+		for (const uint32_t& node : queue)
+		{
+			if (node == r) continue;
+			const SkewHeap::Item& edge = heap.items[in[node]];
+			output.add(Edge(Node(ids[edge.source]), Node(ids[edge.target]), weights[edge.edge]));
+		}
+		return output;
+	}
+
+	Graph SpanningTree::MinimumSpanningForest(const CompactGraph& graph, ThreadPool& pool)
+	{
+		const CompactGraph symmetric = graph.Symmetrize();
+		const size_t n = symmetric.size_nodes();
+		const std::vector<size_t>& offsets = symmetric.offsets();
+		const std::vector<uint32_t>& targets = symmetric.targets();
+		const std::vector<float>& weights = symmetric.weights();
+
+		// Both copies of connection must compare the same way, so ties are broken by position of the copy stored at lower endpoint
+		std::vector<size_t> canonical(targets.size());
+		pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i)
+			{
+				for (size_t e = offsets[i]; e < offsets[i + 1]; ++e)
+				{
+					const uint32_t target = targets[e];
+					if (target >= i) { canonical[e] = e; continue; }
+					canonical[e] = std::lower_bound(targets.begin() + offsets[target], targets.begin() + offsets[target + 1], static_cast<uint32_t>(i)) - targets.begin();
+				}
+			}
+		});
+		auto lighter = [&](const size_t& l, const size_t& r) {
+			if (r == NO_EDGE) return l != NO_EDGE;
+			if (l == NO_EDGE) return false;
+			if (weights[l] != weights[r]) return weights[l] < weights[r];
+			return canonical[l] < canonical[r];
+		};
+
+		std::vector<uint32_t> component(n);
+		for (uint32_t i = 0; i < n; ++i) { component[i] = i; }
+		std::vector<uint32_t> parent(component);
+		auto find = [&](uint32_t node) {
+			while (parent[node] != node)
+			{
+				parent[node] = parent[parent[node]];
+				node = parent[node];
+			}
+			return node;
+		};
+
+		std::vector<std::atomic<size_t>> cheapest(n);
+		std::vector<size_t> forest;
+		bool merged = true;
+		while (merged)
+		{
+			merged = false;
+			pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+				for (size_t c = first; c < last; ++c) { cheapest[c].store(NO_EDGE, std::memory_order_relaxed); }
+			});
+			// Lightest edge leaving every component, in parallel: lightest edge of every node is merged into its' component with compare-and-swap
+			pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+				for (size_t i = first; i < last; ++i)
+				{
+					size_t lightest = NO_EDGE;
+					for (size_t e = offsets[i]; e < offsets[i + 1]; ++e)
+					{
+						if (component[targets[e]] != component[i] && lighter(e, lightest)) lightest = e;
+					}
+					std::atomic<size_t>& current = cheapest[component[i]];
+					size_t expected = current.load(std::memory_order_relaxed);
+					while (lighter(lightest, expected) && !current.compare_exchange_weak(expected, lightest, std::memory_order_relaxed)) {}
+				}
+			});
+			for (uint32_t c = 0; c < n; ++c)
+			{
+				const size_t edge = cheapest[c].load(std::memory_order_relaxed);
+				if (edge == NO_EDGE) continue;
+				// Two components choosing the same connection join only once
+				const uint32_t a = find(c);
+				const uint32_t b = find(component[targets[edge]]);
+				if (a == b) continue;
+				parent[std::max(a, b)] = std::min(a, b);
+				forest.push_back(edge);
+				merged = true;
+			}
+			pool.ParallelFor(0, n, 1024, [&](size_t first, size_t last) {
+				for (size_t i = first; i < last; ++i)
+				{
+					uint32_t root = component[i];
+					while (parent[root] != root) { root = parent[root]; }
+					component[i] = root;
+				}
+			});
+		}
+
+		const std::vector<uint32_t>& ids = symmetric.ids();
+		GraphBuilder builder;
+		builder.reserve(2 * forest.size());
+		for (const uint32_t& id : ids) { builder.add(Node(id)); }
+		for (const size_t& edge : forest)
+		{
+			const uint32_t source = static_cast<uint32_t>(std::upper_bound(offsets.begin(), offsets.end(), edge) - offsets.begin() - 1);
+			builder.add(ids[source], ids[targets[edge]], weights[edge]);
+			builder.add(ids[targets[edge]], ids[source], weights[edge]);
+		}
+		return builder.Build(pool);
+	}
+}
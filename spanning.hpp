@@ -0,0 +1,66 @@
+#ifndef HWDG_SPANNING_HPP
+#define HWDG_SPANNING_HPP
+
+/**
+* @file spanning.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Minimum spanning trees and arborescences.
+*
+* This file contains SpanningTree class, which computes minimum spanning arborescence of directed graph and minimum spanning forest of its' symmetrized view.
+*/
+
+#include <cstdint>
+#include <vector>
+#include "node.hpp"
+#include "graph.hpp"
+#include "compact_graph.hpp"
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	/**
+	* Static class containing spanning tree algorithms.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*
+	* Results are returned as Graph containing spanned nodes and chosen edges, with their original weights. Loops are never chosen.
+	*/
+	class SpanningTree
+	{
+		public:
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			SpanningTree() = delete;
+
+			/**
+			* Minimum spanning arborescence (directed tree with edges pointing away from root), computed with Tarjan's variant of Chu-Liu/Edmonds algorithm.
+			*
+			* Every node picks the lightest incoming edge from mergeable heap, cycles created that way are contracted into single node, with weights of edges entering the cycle reduced by weight of edge they would replace.
+			* Arborescence spans nodes reachable from root, remaining nodes are omitted. Negative weights are allowed.
+			* \param graph Graph in CSR form.
+			* \param root Root of arborescence.
+			* \return Arborescence with edges pointing from parent to child. Every node except root has exactly one incoming edge.
+			* \throws std::out_of_range if root doesn't belong to the graph.
+			* \par Time complexity:
+			* \f$O(edges * log(nodes))\f$
+			*/
+			static Graph Arborescence(const CompactGraph& graph, const Node& root);
+
+			/**
+			* Minimum spanning forest of symmetrized view of the graph (direction of edges is ignored, weight of connection is the lower of both directions), computed with parallel Boruvka algorithm.
+			*
+			* In every round, every component picks the lightest edge leaving it (nodes scan their edges in parallel and offer the lightest one to their component with compare-and-swap), 
+			* then chosen edges join components. 
+			* Ties are broken by position of edge, so result is identical for any number of threads. Negative weights are allowed.
+			* \param graph Graph in CSR form.
+			* \param pool ThreadPool executing the algorithm.
+			* \return Forest containing all nodes of the graph, every chosen connection is present in both directions.
+			* \par Time complexity:
+			* \f$O(\frac{edges * log(nodes)}{threads} + nodes * log(nodes))\f$
+			*/
+			static Graph MinimumSpanningForest(const CompactGraph& graph, ThreadPool& pool = ThreadPool::Default());
+	};
+}
+
+#endif
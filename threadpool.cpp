@@ -0,0 +1,175 @@
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "threadpool.hpp"
+
+namespace HWDG
+{
+	namespace
+	{
+		thread_local const ThreadPool* current_pool = nullptr;
+		thread_local size_t current_worker = 0;
+
+		std::mutex default_lock;
+		std::unique_ptr<ThreadPool> default_pool;
+	}
+
+	ThreadPool::TaskGroup::TaskGroup() : _pending(0), _error(nullptr) {}
+
+	void ThreadPool::TaskGroup::Fail(const std::exception_ptr& error)
+	{
+		std::lock_guard<std::mutex> guard(this->_error_lock);
+		if (!this->_error) this->_error = error;
+	}
+
+	ThreadPool::ThreadPool(size_t threads) : _queued(0), _stop(false)
+	{
+		if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+		// Last deque is shared by threads from outside of the pool
+		for (size_t i = 0; i < threads; ++i) this->_workers.push_back(std::make_unique<Worker>());
+		this->_threads.reserve(threads - 1);
+		for (size_t i = 0; i < threads - 1; ++i)
+		{
+			this->_threads.emplace_back([this, i]() { this->WorkerLoop(i); });
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> guard(this->_sleep_lock);
+			this->_stop = true;
+		}
+		this->_wake.notify_all();
+		for (auto& thread : this->_threads) thread.join();
+	}
+
+	size_t ThreadPool::size(void) const
+	{
+		return this->_workers.size();
+	}
+
+	size_t ThreadPool::Self(void) const
+	{
+		if (current_pool == this) return current_worker;
+		return this->_workers.size() - 1;
+	}
+
+	void ThreadPool::Push(std::function<void()> task)
+	{
+		Worker& worker = *this->_workers[this->Self()];
+		this->_queued++;
+		{
+			std::lock_guard<std::mutex> guard(worker.lock);
+			worker.tasks.push_back(std::move(task));
+		}
+		{
+			std::lock_guard<std::mutex> guard(this->_sleep_lock);
+		}
+		this->_wake.notify_one();
+	}
+
+	bool ThreadPool::RunOne(const size_t& self)
+	{
+		std::function<void()> task;
+		// Own tasks first, newest first (LIFO keeps working set hot)
+		{
+			Worker& worker = *this->_workers[self];
+			std::lock_guard<std::mutex> guard(worker.lock);
+			if (worker.tasks.size())
+			{
+				task = std::move(worker.tasks.back());
+				worker.tasks.pop_back();
+			}
+		}
+		// Steal the oldest task of someone else (FIFO, those are biggest parts of split ranges)
+		for (size_t i = 1; !task && i < this->_workers.size(); ++i)
+		{
+			Worker& victim = *this->_workers[(self + i) % this->_workers.size()];
+			std::lock_guard<std::mutex> guard(victim.lock);
+			if (victim.tasks.size())
+			{
+				task = std::move(victim.tasks.front());
+				victim.tasks.pop_front();
+			}
+		}
+		if (!task) return false;
+		this->_queued--;
+		task();
+		return true;
+	}
+
+	void ThreadPool::WorkerLoop(const size_t& index)
+	{
+		current_pool = this;
+		current_worker = index;
+		while (true)
+		{
+			if (this->RunOne(index)) continue;
+			std::unique_lock<std::mutex> guard(this->_sleep_lock);
+			this->_wake.wait(guard, [this]() { return this->_stop || this->_queued > 0; });
+			if (this->_stop) return;
+		}
+	}
+
+	void ThreadPool::Spawn(TaskGroup& group, std::function<void()> task)
+	{
+		group._pending++;
+		this->Push([&group, task = std::move(task)]() {
+			try { task(); }
+			catch (...) { group.Fail(std::current_exception()); }
+			group._pending--;
+		});
+	}
+
+	void ThreadPool::Wait(TaskGroup& group)
+	{
+		const size_t self = this->Self();
+		while (group._pending > 0)
+		{
+			if (!this->RunOne(self)) std::this_thread::yield();
+		}
+		if (group._error) std::rethrow_exception(group._error);
+	}
+
+	void ThreadPool::ParallelFor(const size_t& begin, const size_t& end, size_t grain, const std::function<void(size_t first, size_t last)>& func)
+	{
+		if (end <= begin) return;
+		if (grain == 0) grain = 1;
+		if (this->size() == 1 || end - begin <= grain)
+		{
+			func(begin, end);
+			return;
+		}
+		TaskGroup group;
+		std::function<void(size_t, size_t)> split = [&](size_t first, size_t last)
+		{
+			while (last - first > grain)
+			{
+				const size_t middle = first + (last - first) / 2;
+				this->Spawn(group, [&split, middle, last]() { split(middle, last); });
+				last = middle;
+			}
+			func(first, last);
+		};
+		try { split(begin, end); }
+		catch (...) { group.Fail(std::current_exception()); }
+		this->Wait(group);
+	}
+
+	ThreadPool& ThreadPool::Default(void)
+	{
+		std::lock_guard<std::mutex> guard(default_lock);
+		if (!default_pool) default_pool = std::make_unique<ThreadPool>();
+		return *default_pool;
+	}
+
+	void ThreadPool::SetDefaultThreads(const size_t& threads)
+	{
+		std::lock_guard<std::mutex> guard(default_lock);
+		default_pool.reset();
+		default_pool = std::make_unique<ThreadPool>(threads);
+	}
+}
@@ -0,0 +1,181 @@
+#ifndef HWDG_THREADPOOL_HPP
+#define HWDG_THREADPOOL_HPP
+
+/**
+* @file threadpool.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Work-stealing thread pool
+*
+* This file contains ThreadPool class, task scheduler shared by all parallel algorithms of this library.
+*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace HWDG
+{
+	/**
+	* Work-stealing thread pool.
+	*
+	* Every worker thread has its' own deque of tasks. Tasks spawned by a worker are pushed to and popped from the back of its' own deque, 
+	* while idle workers steal the oldest tasks from the front of deques of other workers. Thread that waits for its' tasks (ThreadPool::Wait()) executes tasks too, 
+	* so nested parallelism (parallel loop inside of parallel loop) doesn't block.
+	*
+	* Pool is NUMA-unaware, workers aren't pinned to any cores.
+	*
+	* Most algorithms use ThreadPool::Default(), you can change its' number of threads with ThreadPool::SetDefaultThreads().
+	*/
+	class ThreadPool
+	{
+		public:
+			/**
+			* Group of tasks that can be waited for.
+			* It must outlive all of the tasks spawned within it, so always call ThreadPool::Wait() before it goes out of scope.
+			*/
+			class TaskGroup
+			{
+				friend class ThreadPool;
+				private:
+					std::atomic<size_t> _pending;
+					std::exception_ptr _error;
+					std::mutex _error_lock;
+					void Fail(const std::exception_ptr& error);
+				public:
+					TaskGroup();
+					TaskGroup(const TaskGroup&) = delete;
+					TaskGroup& operator = (const TaskGroup&) = delete;
+			};
+		private:
+			struct Worker
+			{
+				std::deque<std::function<void()>> tasks;
+				std::mutex lock;
+			};
+			std::vector<std::unique_ptr<Worker>> _workers;
+			std::vector<std::thread> _threads;
+			std::atomic<size_t> _queued;
+			std::mutex _sleep_lock;
+			std::condition_variable _wake;
+			bool _stop;
+		private:
+			size_t Self(void) const;
+			void Push(std::function<void()> task);
+			bool RunOne(const size_t& self);
+			void WorkerLoop(const size_t& index);
+		public:
+			/**
+			* Create pool.
+			* \param threads Number of threads executing tasks, including thread that waits for them. 0 stands for std::thread::hardware_concurrency()
+			*/
+			explicit ThreadPool(size_t threads = 0);
+
+			/**
+			* Pool can be destroyed only when there're no tasks left.
+			*/
+			~ThreadPool();
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator = (const ThreadPool&) = delete;
+
+			/**
+			* Get number of threads executing tasks, including thread that waits for them.
+			* \return Number of threads.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			size_t size(void) const;
+
+			/**
+			* Spawn task within given group.
+			* \param group Group to which task belongs.
+			* \param task Function (typically lambda expression) to be executed by one of the threads. Exception thrown by the task is rethrown by ThreadPool::Wait()
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			void Spawn(TaskGroup& group, std::function<void()> task);
+
+			/**
+			* Wait until all tasks of given group are finished. Waiting thread executes tasks in the meantime.
+			* \param group Group to wait for.
+			* \throws Exception thrown by any of the tasks within group (if there's more than one, only the first one is rethrown).
+			*/
+			void Wait(TaskGroup& group);
+
+			/**
+			* Parallel loop over range of indices.
+			* Range is split recursively in halves until parts aren't bigger than grain, then halves are spawned as tasks that can be stolen.
+			*
+			* \param begin First index.
+			* \param end Past-last index.
+			* \param grain Maximal number of indices processed by single call of func. Should be big enough to hide cost of task (roughly microsecond).
+			* \param func Function (typically lambda expression) called for subranges [first, last)
+			* \throws Exception thrown by func.
+			* \par Time complexity:
+			* \f$O(\frac{n}{threads})\f$, plus \f$O(\frac{n}{grain})\f$ tasks.
+			*/
+			void ParallelFor(const size_t& begin, const size_t& end, size_t grain, const std::function<void(size_t first, size_t last)>& func);
+
+			/**
+			* Parallel reduction over range of indices.
+			* Range is cut into chunks of size grain, each chunk is mapped separately, then partial results are reduced in order of chunks.
+			* Because of that, result depends only on grain and not on number of threads, even if reduce isn't associative (like floating point addition).
+			*
+			* \tparam TYPE Type of the result. Must be copyable.
+			* \param begin First index.
+			* \param end Past-last index.
+			* \param grain Size of chunk.
+			* \param identity Neutral element of reduction, returned for empty range.
+			* \param map Function computing partial result for subrange [first, last)
+			* \param reduce Function combining two partial results.
+			* \return Reduced result.
+			* \throws Exception thrown by map or reduce.
+			* \par Time complexity:
+			* \f$O(\frac{n}{threads} + \frac{n}{grain})\f$
+			*/
+			template<typename TYPE>
+			TYPE ParallelReduce(const size_t& begin, const size_t& end, size_t grain, const TYPE& identity, const std::function<TYPE(size_t first, size_t last)>& map, const std::function<TYPE(const TYPE& l, const TYPE& r)>& reduce)
+			{
+				if (end <= begin) return identity;
+				if (grain == 0) grain = 1;
+				const size_t chunks = (end - begin + grain - 1) / grain;
+				std::vector<TYPE> partial(chunks, identity);
+				this->ParallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+					for (size_t i = first; i < last; ++i)
+					{
+						partial[i] = map(begin + i * grain, std::min(end, begin + (i + 1) * grain));
+					}
+				});
+				TYPE output = identity;
+				for (const TYPE& value : partial)
+				{
+					output = reduce(output, value);
+				}
+				return output;
+			}
+
+			/**
+			* Get pool shared by algorithms of this library.
+			* It's created on first use, with std::thread::hardware_concurrency() threads.
+			* \return Reference to default pool.
+			*/
+			static ThreadPool& Default(void);
+
+			/**
+			* Recreate default pool with given number of threads.
+			* Must not be called while default pool is in use.
+			* \param threads Number of threads. 0 stands for std::thread::hardware_concurrency()
+			*/
+			static void SetDefaultThreads(const size_t& threads);
+	};
+}
+
+#endif
@@ -87,4 +87,12 @@ namespace HWDG
 		}
 		return output;
 	}
+
+	uint64_t Tools::Mix64(uint64_t value)
+	{
+		value = value + 0x9E3779B97F4A7C15ull;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
 }
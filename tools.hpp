@@ -90,6 +90,15 @@ namespace HWDG
 			*/
 			static inline Graph RandomSparseGraph(size_t size, float density, float weight_min, float weight_max, bool loops) { return RandomLowDensityGraph(size, density, weight_min, weight_max, loops); }
 
+			/**
+			* Mix bits of 64-bit value (splitmix64 finalizer). Used as fast, well-distributed hash of identifiers, for example Edge::id()
+			* \param value Value to be mixed.
+			* \return Hash of the value.
+			* \par Time complexity:
+			* \f$O(1)\f$
+			*/
+			static uint64_t Mix64(uint64_t value);
+
 
 			/** Save object to file in binary mode.
 			*
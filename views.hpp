@@ -0,0 +1,479 @@
+#ifndef HWDG_VIEWS_HPP
+#define HWDG_VIEWS_HPP
+
+/**
+* @file views.hpp
+* @author Jakub Grzana
+* @date October 2026
+* @brief Lazy, non-owning views of graphs.
+*
+* This file contains view classes (GraphView, UnionView, IntersectionView, FilterView, InducedSubgraphView) and ViewTraversal class, which runs traversal and pathfinding over any of them.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stack>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#include "node.hpp"
+#include "edge.hpp"
+#include "node_in_graph.hpp"
+#include "graph.hpp"
+#include "path.hpp"
+#include "bfspathfinding.hpp"
+#include "tools.hpp"
+
+/*
+* Every view provides the same interface, so views can be nested (for example, FilterView of UnionView) and passed to ViewTraversal:
+* - bool has(const Node&) const
+* - bool has(const Edge&) const, weight is ignored
+* - float weight(const Edge&) const, weight of edge as seen through the view. Edge must belong to view
+* - void for_each_node(F f) const, calls f(const Node&) for every node
+* - void for_each_edge(const Node& source, F f) const, calls f(const Edge&) for every edge coming out from source, with weight as seen through the view
+*
+* Views don't own graphs they were created from. Underlying graphs must outlive the view and must not be modified while view is in use.
+*/
+
+namespace HWDG
+{
+	/**
+	* View of whole Graph, adapting it to the interface of views.
+	*/
+	class GraphView
+	{
+		private:
+			const Graph* _graph;
+		public:
+			/**
+			* Create view of the Graph.
+			* \param graph Viewed Graph. Must outlive the view.
+			*/
+			GraphView(const Graph& graph) : _graph(&graph) {}
+
+			bool has(const Node& node) const { return this->_graph->has(node); }
+			bool has(const Edge& edge) const { return this->_graph->has(edge); }
+			float weight(const Edge& edge) const { return this->_graph->fetch(edge).weight(); }
+
+			template<typename FUNCTION>
+			void for_each_node(FUNCTION f) const
+			{
+				for (const NodeInGraph& node : *this->_graph) { f((const Node&)node); }
+			}
+
+			template<typename FUNCTION>
+			void for_each_edge(const Node& source, FUNCTION f) const
+			{
+				auto iter = this->_graph->get_node(source);
+				if (iter == this->_graph->end()) return;
+				for (const Edge& edge : *iter) { f(edge); }
+			}
+	};
+
+	/**
+	* Type stored by views for component of type TYPE: Graph is wrapped in GraphView, other views are stored as they are.
+	*/
+	template<typename TYPE>
+	using ViewOf = typename std::conditional<std::is_same<TYPE, Graph>::value, GraphView, TYPE>::type;
+
+	/**
+	* Lazy equivalent of Operations::Union(const Graph&, const Graph&): nodes and edges of both components, weights of common edges are added.
+	*/
+	template<typename A = Graph, typename B = Graph>
+	class UnionView
+	{
+		private:
+			ViewOf<A> _a;
+			ViewOf<B> _b;
+		public:
+			/**
+			* Create view of union.
+			* \param a Graph (or view) A. Must outlive the view.
+			* \param b Graph (or view) B. Must outlive the view.
+			*/
+			UnionView(const A& a, const B& b) : _a(a), _b(b) {}
+
+			bool has(const Node& node) const { return this->_a.has(node) || this->_b.has(node); }
+			bool has(const Edge& edge) const { return this->_a.has(edge) || this->_b.has(edge); }
+			float weight(const Edge& edge) const
+			{
+				if (!this->_a.has(edge)) return this->_b.weight(edge);
+				if (!this->_b.has(edge)) return this->_a.weight(edge);
+				return this->_a.weight(edge) + this->_b.weight(edge);
+			}
+
+			template<typename FUNCTION>
+			void for_each_node(FUNCTION f) const
+			{
+				this->_a.for_each_node(f);
+				this->_b.for_each_node([&](const Node& node) { if (!this->_a.has(node)) f(node); });
+			}
+
+			template<typename FUNCTION>
+			void for_each_edge(const Node& source, FUNCTION f) const
+			{
+				this->_a.for_each_edge(source, [&](const Edge& edge) {
+					if (!this->_b.has(edge)) { f(edge); return; }
+					f(Edge(edge.source(), edge.target(), edge.weight() + this->_b.weight(edge)));
+				});
+				this->_b.for_each_edge(source, [&](const Edge& edge) { if (!this->_a.has(edge)) f(edge); });
+			}
+	};
+
+	/**
+	* Lazy equivalent of Operations::Intersection(): nodes and edges that belong to both components, weights are balanced.
+	*/
+	template<typename A = Graph, typename B = Graph>
+	class IntersectionView
+	{
+		private:
+			ViewOf<A> _a;
+			ViewOf<B> _b;
+			float _balancer;
+		public:
+			/**
+			* Create view of intersection.
+			* \param a Graph (or view) A. Must outlive the view.
+			* \param b Graph (or view) B. Must outlive the view.
+			* \param balancer Balancing factor used in weight computation. MUST belong to [0,1]
+			*/
+			IntersectionView(const A& a, const B& b, float balancer) : _a(a), _b(b), _balancer(balancer) {}
+
+			bool has(const Node& node) const { return this->_a.has(node) && this->_b.has(node); }
+			bool has(const Edge& edge) const { return this->_a.has(edge) && this->_b.has(edge); }
+			float weight(const Edge& edge) const
+			{
+				float weight_from_a = this->_balancer * this->_a.weight(edge);
+				float weight_from_b = ((float)1.0 - this->_balancer) * this->_b.weight(edge);
+				return weight_from_a + weight_from_b;
+			}
+
+			template<typename FUNCTION>
+			void for_each_node(FUNCTION f) const
+			{
+				this->_a.for_each_node([&](const Node& node) { if (this->_b.has(node)) f(node); });
+			}
+
+			template<typename FUNCTION>
+			void for_each_edge(const Node& source, FUNCTION f) const
+			{
+				this->_a.for_each_edge(source, [&](const Edge& edge) {
+					if (!this->_b.has(edge)) return;
+					float weight_from_a = this->_balancer * edge.weight();
+					float weight_from_b = ((float)1.0 - this->_balancer) * this->_b.weight(edge);
+					f(Edge(edge.source(), edge.target(), weight_from_a + weight_from_b));
+				});
+			}
+	};
+
+	/**
+	* View hiding edges that don't satisfy predicate. All nodes remain visible.
+	*
+	* Predicate is called with Edge (and its' weight) as seen through the underlying view: bool predicate(const Edge&)
+	*/
+	template<typename A, typename PREDICATE>
+	class FilterView
+	{
+		private:
+			ViewOf<A> _a;
+			PREDICATE _predicate;
+		public:
+			/**
+			* Create filtered view.
+			* \param a Graph (or view) A. Must outlive the view.
+			* \param predicate Edges for which predicate returns false are hidden.
+			*/
+			FilterView(const A& a, PREDICATE predicate) : _a(a), _predicate(predicate) {}
+
+			bool has(const Node& node) const { return this->_a.has(node); }
+			bool has(const Edge& edge) const
+			{
+				if (!this->_a.has(edge)) return false;
+				return this->_predicate(Edge(edge.source(), edge.target(), this->_a.weight(edge)));
+			}
+			float weight(const Edge& edge) const { return this->_a.weight(edge); }
+
+			template<typename FUNCTION>
+			void for_each_node(FUNCTION f) const
+			{
+				this->_a.for_each_node(f);
+			}
+
+			template<typename FUNCTION>
+			void for_each_edge(const Node& source, FUNCTION f) const
+			{
+				this->_a.for_each_edge(source, [&](const Edge& edge) { if (this->_predicate(edge)) f(edge); });
+			}
+	};
+
+	/**
+	* View of subgraph induced by set of nodes: only chosen nodes and edges between them are visible.
+	*/
+	template<typename A = Graph>
+	class InducedSubgraphView
+	{
+		private:
+			ViewOf<A> _a;
+			std::unordered_set<uint32_t> _nodes;
+		public:
+			/**
+			* Create view of induced subgraph.
+			* \param a Graph (or view) A. Must outlive the view.
+			* \param nodes Nodes of subgraph. Nodes that don't belong to A are ignored.
+			* \par Time complexity:
+			* \f$O(nodes)\f$
+			*/
+			InducedSubgraphView(const A& a, const std::vector<Node>& nodes) : _a(a)
+			{
+				this->_nodes.reserve(nodes.size());
+				for (const Node& node : nodes) { this->_nodes.insert(node.id()); }
+			}
+
+			bool has(const Node& node) const { return this->_nodes.count(node.id()) && this->_a.has(node); }
+			bool has(const Edge& edge) const
+			{
+				return this->_nodes.count(edge.source().id()) && this->_nodes.count(edge.target().id()) && this->_a.has(edge);
+			}
+			float weight(const Edge& edge) const { return this->_a.weight(edge); }
+
+			template<typename FUNCTION>
+			void for_each_node(FUNCTION f) const
+			{
+				for (const uint32_t& id : this->_nodes) { if (this->_a.has(Node(id))) f(Node(id)); }
+			}
+
+			template<typename FUNCTION>
+			void for_each_edge(const Node& source, FUNCTION f) const
+			{
+				if (!this->_nodes.count(source.id())) return;
+				this->_a.for_each_edge(source, [&](const Edge& edge) { if (this->_nodes.count(edge.target().id())) f(edge); });
+			}
+	};
+
+	/**
+	* Static class containing traversal and pathfinding over views. Each function accepts Graph or any view from views.hpp, results are the same as for materialized Graph.
+	* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+	*/
+	class ViewTraversal
+	{
+		private:
+			static GraphView Adapt(const Graph& graph) { return GraphView(graph); }
+			template<typename VIEW>
+			static const VIEW& Adapt(const VIEW& view) { return view; }
+		public:
+			/**
+			* This is static class, so you can't create instances (objects) of it, and all methods are static member function.
+			*/
+			ViewTraversal() = delete;
+
+			/**
+			* Breadth First Search (BFS) of view. Check Operations::BreadthFirstSearch()
+			* \param view Graph or view to be traversed.
+			* \param starting_node Node from which search starts.
+			* \param func Function called for every Edge leading to newly visited Node.
+			* \throws std::invalid_argument if starting node isn't part of view.
+			* \par Time complexity:
+			* \f$O(edges)\f$ of the view.
+			*/
+			template<typename VIEW>
+			static void BreadthFirstSearch(const VIEW& view, const Node& starting_node, std::function<void(const Edge& edge, const std::unordered_set<Node, Node::HashFunction>& visited)> func)
+			{
+				const auto& adapted = ViewTraversal::Adapt(view);
+				if (!adapted.has(starting_node)) { throw std::invalid_argument("BreadthFirstSearch: starting node isn't part of given view"); }
+				std::unordered_set<Node, Node::HashFunction> visited;
+				std::queue<Node> next;
+				next.push(starting_node); visited.insert(starting_node);
+				while (next.size())
+				{
+					const Node current = next.front(); next.pop();
+					adapted.for_each_edge(current, [&](const Edge& edge) {
+						if (visited.count(edge.target())) return;
+						next.push(edge.target());
+						visited.insert(edge.target());
+						func(edge, visited);
+					});
+				}
+			}
+
+			/**
+			* Depth First Search (DFS) of view. Check Operations::DepthFirstSearch()
+			* \param view Graph or view to be traversed.
+			* \param starting_node Node from which search starts.
+			* \param func Function called for every Edge leading to newly visited Node.
+			* \throws std::invalid_argument if starting node isn't part of view.
+			* \par Time complexity:
+			* \f$O(edges)\f$ of the view.
+			*/
+			template<typename VIEW>
+			static void DepthFirstSearch(const VIEW& view, const Node& starting_node, std::function<void(const Edge& edge, const std::unordered_set<Node, Node::HashFunction>& visited)> func)
+			{
+				const auto& adapted = ViewTraversal::Adapt(view);
+				if (!adapted.has(starting_node)) { throw std::invalid_argument("DepthFirstSearch: starting node isn't part of given view"); }
+				std::unordered_set<Node, Node::HashFunction> visited;
+				std::stack<Edge> next;
+				std::vector<Edge> res;
+				visited.insert(starting_node);
+				adapted.for_each_edge(starting_node, [&](const Edge& edge) { res.push_back(edge); });
+				for (auto iter = res.rbegin(); iter != res.rend(); ++iter) { next.push(*iter); }
+				while (next.size())
+				{
+					Edge current = next.top(); next.pop();
+					// Check if target node was visited, since stack allows duplicates. Skip if that's the case
+					if (visited.count(current.target())) continue;
+					visited.insert(current.target());
+					func(current, visited);
+					res.clear();
+					adapted.for_each_edge(current.target(), [&](const Edge& edge) { res.push_back(edge); });
+					for (auto iter = res.rbegin(); iter != res.rend(); ++iter) { next.push(*iter); }
+				}
+			}
+
+			/**
+			* Shortest path (by sum of weights) between two nodes, computed with Dijkstra algorithm. Check Dijkstra::ComputePath()
+			* \param view Graph or view to be searched.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \param workspace Memory reused between queries.
+			* \return Path from src to tgt. Path doesn't exist if tgt can't be reached.
+			* \throws std::invalid_argument if src isn't part of view, or if search encounters Edge with negative weight.
+			* \par Time complexity:
+			* \f$O(edges * log(edges))\f$ of the view.
+			*/
+			template<typename VIEW>
+			static Path DijkstraPath(const VIEW& view, const Node& src, const Node& tgt, Workspace& workspace)
+			{
+				const auto& adapted = ViewTraversal::Adapt(view);
+				if (!adapted.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given view", src.str().c_str()));
+				workspace.Clear();
+				auto& cells = workspace._cells;
+				auto& queue = workspace._queue;
+				const auto compare = std::greater<std::pair<double, uint32_t>>();
+				cells.insert({ src.id(), PathtableCell(src, src) });
+				queue.push_back({ 0, src.id() });
+
+				// Dijkstra Algorithm with lazy deletion, as in Dijkstra::ComputePath()
+				while (queue.size())
+				{
+					std::pop_heap(queue.begin(), queue.end(), compare);
+					const double pathweight = queue.back().first;
+					const uint32_t id = queue.back().second;
+					queue.pop_back();
+					if (pathweight > cells.at(id).pathweight) continue;
+					if (id == tgt.id()) break;
+
+					adapted.for_each_edge(Node(id), [&](const Edge& edge) {
+						if (edge.weight() < 0) throw std::invalid_argument("Dijkstra algorithm cannot be used for graphs with negative weights of edges.");
+						double pathweight_from_current = pathweight + edge.weight();
+						auto iter = cells.find(edge.target().id());
+						if (iter == cells.end())
+						{
+							cells.insert({ edge.target().id(), PathtableCell(edge.target(), pathweight_from_current, id) });
+						}
+						else if (iter->second.pathweight > pathweight_from_current)
+						{
+							iter->second.pathweight = pathweight_from_current;
+							iter->second.prev_id = id;
+						}
+						else return;
+						queue.push_back({ pathweight_from_current, edge.target().id() });
+						std::push_heap(queue.begin(), queue.end(), compare);
+					});
+				}
+				return workspace.GetPath(tgt);
+			}
+
+			/**
+			* Shortest path (by sum of weights) between two nodes, computed with Dijkstra algorithm. Check Dijkstra::ComputePath()
+			* \param view Graph or view to be searched.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \return Path from src to tgt. Path doesn't exist if tgt can't be reached.
+			* \throws std::invalid_argument if src isn't part of view, or if search encounters Edge with negative weight.
+			* \par Time complexity:
+			* \f$O(edges * log(edges))\f$ of the view.
+			*/
+			template<typename VIEW>
+			static Path DijkstraPath(const VIEW& view, const Node& src, const Node& tgt)
+			{
+				Workspace workspace;
+				return ViewTraversal::DijkstraPath(view, src, tgt, workspace);
+			}
+
+			/**
+			* Path with the least number of edges between two nodes, computed with BFS. Check BFSPathfinding::ComputePath()
+			* \param view Graph or view to be searched.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \param workspace Memory reused between queries.
+			* \return Path from src to tgt. Path doesn't exist if tgt can't be reached.
+			* \throws std::invalid_argument if src isn't part of view.
+			* \par Time complexity:
+			* \f$O(edges)\f$ of the view.
+			*/
+			template<typename VIEW>
+			static Path BFSPath(const VIEW& view, const Node& src, const Node& tgt, Workspace& workspace)
+			{
+				const auto& adapted = ViewTraversal::Adapt(view);
+				if (!adapted.has(src)) throw std::invalid_argument(Tools::string_format("Node %s doesn't belong to given view", src.str().c_str()));
+				workspace.Clear();
+				auto& cells = workspace._cells;
+				auto& queue = workspace._queue;
+				cells.insert({ src.id(), PathtableCell(src, src) });
+				queue.push_back({ 0, src.id() });
+				for (size_t first = 0; first < queue.size(); ++first)
+				{
+					const double hops = queue[first].first;
+					const uint32_t id = queue[first].second;
+					if (id == tgt.id()) break;
+					adapted.for_each_edge(Node(id), [&](const Edge& edge) {
+						if (cells.count(edge.target().id())) return;
+						cells.insert({ edge.target().id(), PathtableCell(edge.target(), hops + BFSPathfinding::EdgeWeight, id) });
+						queue.push_back({ hops + BFSPathfinding::EdgeWeight, edge.target().id() });
+					});
+				}
+				return workspace.GetPath(tgt);
+			}
+
+			/**
+			* Path with the least number of edges between two nodes, computed with BFS. Check BFSPathfinding::ComputePath()
+			* \param view Graph or view to be searched.
+			* \param src Source Node.
+			* \param tgt Target Node.
+			* \return Path from src to tgt. Path doesn't exist if tgt can't be reached.
+			* \throws std::invalid_argument if src isn't part of view.
+			* \par Time complexity:
+			* \f$O(edges)\f$ of the view.
+			*/
+			template<typename VIEW>
+			static Path BFSPath(const VIEW& view, const Node& src, const Node& tgt)
+			{
+				Workspace workspace;
+				return ViewTraversal::BFSPath(view, src, tgt, workspace);
+			}
+
+			/**
+			* Build Graph containing all nodes and edges of the view.
+			* \param view Graph or view to be materialized.
+			* \return Graph equal to the view.
+			* \par Time complexity:
+			* \f$O(edges)\f$ of the view.
+			*/
+			template<typename VIEW>
+			static Graph Materialize(const VIEW& view)
+			{
+				const auto& adapted = ViewTraversal::Adapt(view);
+				Graph output;
+				adapted.for_each_node([&](const Node& node) { output.add(node); });
+				adapted.for_each_node([&](const Node& node) {
+					adapted.for_each_edge(node, [&](const Edge& edge) { output.add(edge); });
+				});
+				return output;
+			}
+	};
+}
+
+#endif